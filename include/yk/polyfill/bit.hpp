@@ -5,12 +5,14 @@
 
 #include <yk/polyfill/type_traits.hpp>
 
+#include <limits>
 #include <memory>
 #include <type_traits>
 
+#include <cstddef>
 #include <cstring>
 
-#if __cpp_lib_bit_cast >= 201806L
+#if __cpp_lib_bit_cast >= 201806L || __cpp_lib_endian >= 201907L
 #include <bit>
 #endif
 
@@ -18,23 +20,318 @@ namespace yk {
 
 namespace polyfill {
 
-// `dst` second parameter is a scratch space for memcpy destination in the pre-C++20 fallback.
-// Supply an arbitrary `To` value to bypass the default construction requirement for non-default-constructible types.
-// Ignored when std::bit_cast is available.
-template<
-    class To, class From,
-    typename std::enable_if<
-        conjunction<std::is_trivially_copyable<From>, std::is_trivially_copyable<To>, bool_constant<sizeof(From) == sizeof(To)>>::value, std::nullptr_t>::type =
-        nullptr>
-YK_POLYFILL_CXX20_CONSTEXPR To bit_cast(From const& from, To dst = To{}) noexcept
-{
+#if __cpp_lib_endian >= 201907L
+
+using std::endian;
+
+#else
+
+enum class endian {
+#if defined(_MSC_VER) && !defined(__clang__)
+  little = 0,
+  big = 1,
+  native = little,
+#else
+  little = __ORDER_LITTLE_ENDIAN__,
+  big = __ORDER_BIG_ENDIAN__,
+  native = __BYTE_ORDER__,
+#endif
+};
+
+#endif
+
+// __builtin_bit_cast is available before C++20 on GCC 11+, Clang 9+ and MSVC 19.27+, in every language mode
 #if __cpp_lib_bit_cast >= 201806L
-  (void)dst;
+#define YK_POLYFILL_DETAIL_BIT_CAST_IMPL 1  // std::bit_cast
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_bit_cast)
+#define YK_POLYFILL_DETAIL_BIT_CAST_IMPL 2  // __builtin_bit_cast
+#endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1927
+#define YK_POLYFILL_DETAIL_BIT_CAST_IMPL 2
+#endif
+
+#ifndef YK_POLYFILL_DETAIL_BIT_CAST_IMPL
+#define YK_POLYFILL_DETAIL_BIT_CAST_IMPL 0  // memcpy
+#endif
+
+// 1 if bit_cast is usable in constant expressions
+#if YK_POLYFILL_DETAIL_BIT_CAST_IMPL != 0
+#define YK_POLYFILL_CONSTEXPR_BIT_CAST 1
+#else
+#define YK_POLYFILL_CONSTEXPR_BIT_CAST 0
+#endif
+
+namespace detail {
+
+template<class To, class From>
+struct is_bit_castable
+    : conjunction<std::is_trivially_copyable<From>, std::is_trivially_copyable<To>, bool_constant<sizeof(From) == sizeof(To)>> {};
+
+}  // namespace detail
+
+#if YK_POLYFILL_CONSTEXPR_BIT_CAST
+
+template<class To, class From, typename std::enable_if<detail::is_bit_castable<To, From>::value, std::nullptr_t>::type = nullptr>
+constexpr To bit_cast(From const& from) noexcept
+{
+#if YK_POLYFILL_DETAIL_BIT_CAST_IMPL == 1
   return std::bit_cast<To>(from);
 #else
+  return __builtin_bit_cast(To, from);
+#endif
+}
+
+// `dst` is the scratch object of the memcpy fallback; ignored here
+template<class To, class From, typename std::enable_if<detail::is_bit_castable<To, From>::value, std::nullptr_t>::type = nullptr>
+constexpr To bit_cast(From const& from, To const& dst) noexcept
+{
+  return (void)dst, polyfill::bit_cast<To>(from);
+}
+
+#else
+
+// `dst` second parameter is a scratch space for the memcpy destination.
+// Supply an arbitrary `To` value to bypass the default construction requirement for non-default-constructible types.
+template<class To, class From, typename std::enable_if<detail::is_bit_castable<To, From>::value, std::nullptr_t>::type = nullptr>
+To bit_cast(From const& from, To dst = To{}) noexcept
+{
   std::memcpy(std::addressof(dst), std::addressof(from), sizeof(To));
   return dst;
+}
+
+#endif
+
+#undef YK_POLYFILL_DETAIL_BIT_CAST_IMPL
+
+// bit manipulation
+// GCC and Clang lower these to __builtin_* intrinsics (usable in constant expressions); other compilers get portable
+// constexpr fallbacks. As in <bit>, the counting and power-of-two functions accept unsigned integer types only
+// (no bool or character types), and byteswap accepts any integer type.
+
+namespace detail {
+
+template<class T>
+struct is_bit_unsigned : bool_constant<
+                             std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<typename std::remove_cv<T>::type, bool>::value
+                             && !std::is_same<typename std::remove_cv<T>::type, char>::value
+                             && !std::is_same<typename std::remove_cv<T>::type, wchar_t>::value
+                             && !std::is_same<typename std::remove_cv<T>::type, char16_t>::value
+#if __cpp_char8_t >= 201811L
+                             && !std::is_same<typename std::remove_cv<T>::type, char8_t>::value
+#endif
+                             && !std::is_same<typename std::remove_cv<T>::type, char32_t>::value> {
+};
+
+template<class T>
+using enable_if_bit_unsigned = typename std::enable_if<is_bit_unsigned<T>::value, std::nullptr_t>::type;
+
+#if defined(__GNUC__) || defined(__clang__)
+#define YK_POLYFILL_DETAIL_BIT_BUILTINS 1
+#else
+#define YK_POLYFILL_DETAIL_BIT_BUILTINS 0
 #endif
+
+// Which builtin width fits T: 0 = unsigned int, 1 = unsigned long, 2 = unsigned long long, 3 = none (wider than 64 bits)
+template<class T>
+struct bit_builtin_rank
+    : integral_constant<
+          int, std::numeric_limits<T>::digits <= std::numeric_limits<unsigned>::digits             ? 0
+               : std::numeric_limits<T>::digits <= std::numeric_limits<unsigned long>::digits      ? 1
+               : std::numeric_limits<T>::digits <= std::numeric_limits<unsigned long long>::digits ? 2
+                                                                                                    : 3> {};
+
+// portable fallbacks (C++11 constexpr: a single return statement each)
+
+template<class T>
+constexpr int popcount_fallback(T x) noexcept
+{
+  return x == 0 ? 0 : 1 + detail::popcount_fallback(static_cast<T>(x & (x - 1)));
+}
+
+// precondition: x != 0
+template<class T>
+constexpr int countl_zero_fallback(T x) noexcept
+{
+  return (x >> (std::numeric_limits<T>::digits - 1)) != 0 ? 0 : 1 + detail::countl_zero_fallback(static_cast<T>(x << 1));
+}
+
+// precondition: x != 0
+template<class T>
+constexpr int countr_zero_fallback(T x) noexcept
+{
+  return (x & 1) != 0 ? 0 : 1 + detail::countr_zero_fallback(static_cast<T>(x >> 1));
+}
+
+template<class T>
+constexpr T byteswap_fallback(T x, std::size_t i = 0) noexcept
+{
+  return i == sizeof(T) ? T(0)
+                        : static_cast<T>(
+                              static_cast<T>(static_cast<T>((x >> (i * 8)) & 0xFFu) << ((sizeof(T) - 1 - i) * 8)) | detail::byteswap_fallback(x, i + 1)
+                          );
+}
+
+template<class T, int Rank = bit_builtin_rank<T>::value, bool = YK_POLYFILL_DETAIL_BIT_BUILTINS>
+struct bit_ops {
+  static constexpr int popcount(T x) noexcept { return detail::popcount_fallback(x); }
+  static constexpr int countl_zero_nonzero(T x) noexcept { return detail::countl_zero_fallback(x); }
+  static constexpr int countr_zero_nonzero(T x) noexcept { return detail::countr_zero_fallback(x); }
+};
+
+#if YK_POLYFILL_DETAIL_BIT_BUILTINS
+
+template<class T>
+struct bit_ops<T, 0, true> {
+  static constexpr int popcount(T x) noexcept { return __builtin_popcount(x); }
+  static constexpr int countl_zero_nonzero(T x) noexcept
+  {
+    return __builtin_clz(x) - (std::numeric_limits<unsigned>::digits - std::numeric_limits<T>::digits);
+  }
+  static constexpr int countr_zero_nonzero(T x) noexcept { return __builtin_ctz(x); }
+};
+
+template<class T>
+struct bit_ops<T, 1, true> {
+  static constexpr int popcount(T x) noexcept { return __builtin_popcountl(x); }
+  static constexpr int countl_zero_nonzero(T x) noexcept
+  {
+    return __builtin_clzl(x) - (std::numeric_limits<unsigned long>::digits - std::numeric_limits<T>::digits);
+  }
+  static constexpr int countr_zero_nonzero(T x) noexcept { return __builtin_ctzl(x); }
+};
+
+template<class T>
+struct bit_ops<T, 2, true> {
+  static constexpr int popcount(T x) noexcept { return __builtin_popcountll(x); }
+  static constexpr int countl_zero_nonzero(T x) noexcept
+  {
+    return __builtin_clzll(x) - (std::numeric_limits<unsigned long long>::digits - std::numeric_limits<T>::digits);
+  }
+  static constexpr int countr_zero_nonzero(T x) noexcept { return __builtin_ctzll(x); }
+};
+
+#endif
+
+template<class T, std::size_t Size = sizeof(T), bool = YK_POLYFILL_DETAIL_BIT_BUILTINS>
+struct byteswap_op {
+  static constexpr T apply(T x) noexcept { return detail::byteswap_fallback(x); }
+};
+
+template<class T, bool Builtins>
+struct byteswap_op<T, 1, Builtins> {
+  static constexpr T apply(T x) noexcept { return x; }
+};
+
+#if YK_POLYFILL_DETAIL_BIT_BUILTINS
+
+template<class T>
+struct byteswap_op<T, 2, true> {
+  static constexpr T apply(T x) noexcept { return __builtin_bswap16(x); }
+};
+
+template<class T>
+struct byteswap_op<T, 4, true> {
+  static constexpr T apply(T x) noexcept { return __builtin_bswap32(x); }
+};
+
+template<class T>
+struct byteswap_op<T, 8, true> {
+  static constexpr T apply(T x) noexcept { return __builtin_bswap64(x); }
+};
+
+#endif
+
+#undef YK_POLYFILL_DETAIL_BIT_BUILTINS
+
+}  // namespace detail
+
+template<class T, detail::enable_if_bit_unsigned<T> = nullptr>
+constexpr int popcount(T x) noexcept
+{
+  return detail::bit_ops<T>::popcount(x);
+}
+
+template<class T, detail::enable_if_bit_unsigned<T> = nullptr>
+constexpr int countl_zero(T x) noexcept
+{
+  return x == 0 ? std::numeric_limits<T>::digits : detail::bit_ops<T>::countl_zero_nonzero(x);
+}
+
+template<class T, detail::enable_if_bit_unsigned<T> = nullptr>
+constexpr int countr_zero(T x) noexcept
+{
+  return x == 0 ? std::numeric_limits<T>::digits : detail::bit_ops<T>::countr_zero_nonzero(x);
+}
+
+template<class T, detail::enable_if_bit_unsigned<T> = nullptr>
+constexpr int countl_one(T x) noexcept
+{
+  return polyfill::countl_zero(static_cast<T>(~x));
+}
+
+template<class T, detail::enable_if_bit_unsigned<T> = nullptr>
+constexpr int countr_one(T x) noexcept
+{
+  return polyfill::countr_zero(static_cast<T>(~x));
+}
+
+template<class T, detail::enable_if_bit_unsigned<T> = nullptr>
+constexpr bool has_single_bit(T x) noexcept
+{
+  return x != 0 && (x & (x - 1)) == 0;
+}
+
+template<class T, detail::enable_if_bit_unsigned<T> = nullptr>
+constexpr int bit_width(T x) noexcept
+{
+  return std::numeric_limits<T>::digits - polyfill::countl_zero(x);
+}
+
+template<class T, detail::enable_if_bit_unsigned<T> = nullptr>
+constexpr T bit_floor(T x) noexcept
+{
+  return x == 0 ? T(0) : static_cast<T>(T(1) << (polyfill::bit_width(x) - 1));
+}
+
+// precondition: the result is representable in T
+template<class T, detail::enable_if_bit_unsigned<T> = nullptr>
+constexpr T bit_ceil(T x) noexcept
+{
+  return x <= 1 ? T(1) : static_cast<T>(T(1) << polyfill::bit_width(static_cast<T>(x - 1)));
+}
+
+template<class T, detail::enable_if_bit_unsigned<T> = nullptr>
+constexpr T rotr(T x, int s) noexcept;
+
+template<class T, detail::enable_if_bit_unsigned<T> = nullptr>
+constexpr T rotl(T x, int s) noexcept
+{
+  return s % std::numeric_limits<T>::digits == 0 ? x
+         : s % std::numeric_limits<T>::digits > 0
+             ? static_cast<T>(
+                   static_cast<T>(x << (s % std::numeric_limits<T>::digits))
+                   | static_cast<T>(x >> (std::numeric_limits<T>::digits - s % std::numeric_limits<T>::digits))
+               )
+             : polyfill::rotr(x, -(s % std::numeric_limits<T>::digits));
+}
+
+template<class T, detail::enable_if_bit_unsigned<T>>
+constexpr T rotr(T x, int s) noexcept
+{
+  return s % std::numeric_limits<T>::digits == 0 ? x
+         : s % std::numeric_limits<T>::digits > 0
+             ? static_cast<T>(
+                   static_cast<T>(x >> (s % std::numeric_limits<T>::digits))
+                   | static_cast<T>(x << (std::numeric_limits<T>::digits - s % std::numeric_limits<T>::digits))
+               )
+             : polyfill::rotl(x, -(s % std::numeric_limits<T>::digits));
+}
+
+template<class T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<typename std::remove_cv<T>::type, bool>::value, std::nullptr_t>::type = nullptr>
+constexpr T byteswap(T x) noexcept
+{
+  return static_cast<T>(detail::byteswap_op<typename std::make_unsigned<T>::type>::apply(static_cast<typename std::make_unsigned<T>::type>(x)));
 }
 
 }  // namespace polyfill
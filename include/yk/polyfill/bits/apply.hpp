@@ -15,8 +15,28 @@ namespace yk {
 
 namespace polyfill {
 
+template<class... Ts>
+class tuple;
+
 namespace detail {
 
+template<class T, class = void>
+struct std_tuple_size {};
+
+template<class T>
+struct std_tuple_size<T, void_t<decltype(std::tuple_size<T>::value)>> : integral_constant<std::size_t, std::tuple_size<T>::value> {};
+
+// Number of elements of a tuple-like Tuple (possibly cv/ref-qualified); no member `value` if Tuple is not tuple-like.
+// polyfill::tuple is answered directly, without instantiating std::tuple_size.
+template<class T>
+struct apply_size_impl : std_tuple_size<T> {};
+
+template<class... Ts>
+struct apply_size_impl<tuple<Ts...>> : integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template<class Tuple>
+struct apply_size : apply_size_impl<typename remove_cvref<Tuple>::type> {};
+
 namespace apply_guard {
 
 // injects `std::get`, since unqualified `get<I>(t)` call won't trigger ADL until C++20
@@ -43,7 +63,7 @@ struct is_applicable_impl : false_type {};
 template<class F, class Tuple>
 struct is_applicable_impl<
     F, Tuple,
-    void_t<decltype(apply_guard::apply_impl<make_index_sequence<std::tuple_size<typename std::remove_reference<Tuple>::type>::value>>::
+    void_t<decltype(apply_guard::apply_impl<make_index_sequence<apply_size<Tuple>::value>>::
                         apply(std::declval<F>(), std::declval<Tuple>()))>> : true_type {};
 
 template<class F, class Tuple, class = void>
@@ -52,9 +72,9 @@ struct is_nothrow_applicable_impl : false_type {};
 template<class F, class Tuple>
 struct is_nothrow_applicable_impl<
     F, Tuple,
-    void_t<decltype(apply_guard::apply_impl<make_index_sequence<std::tuple_size<typename std::remove_reference<Tuple>::type>::value>>::
+    void_t<decltype(apply_guard::apply_impl<make_index_sequence<apply_size<Tuple>::value>>::
                         apply(std::declval<F>(), std::declval<Tuple>()))>>
-    : bool_constant<noexcept(apply_guard::apply_impl<make_index_sequence<std::tuple_size<typename std::remove_reference<Tuple>::type>::value>>::apply(
+    : bool_constant<noexcept(apply_guard::apply_impl<make_index_sequence<apply_size<Tuple>::value>>::apply(
           std::declval<F>(), std::declval<Tuple>()
       ))> {};
 
@@ -64,9 +84,9 @@ struct apply_result_impl {};
 template<class F, class Tuple>
 struct apply_result_impl<
     F, Tuple,
-    void_t<decltype(apply_guard::apply_impl<make_index_sequence<std::tuple_size<typename std::remove_reference<Tuple>::type>::value>>::
+    void_t<decltype(apply_guard::apply_impl<make_index_sequence<apply_size<Tuple>::value>>::
                         apply(std::declval<F>(), std::declval<Tuple>()))>> {
-  using type = decltype(apply_guard::apply_impl<make_index_sequence<std::tuple_size<typename std::remove_reference<Tuple>::type>::value>>::apply(
+  using type = decltype(apply_guard::apply_impl<make_index_sequence<apply_size<Tuple>::value>>::apply(
       std::declval<F>(), std::declval<Tuple>()
   ));
 };
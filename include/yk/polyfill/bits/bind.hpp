@@ -0,0 +1,165 @@
+#ifndef YK_ZZ_POLYFILL_BITS_BIND_HPP
+#define YK_ZZ_POLYFILL_BITS_BIND_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <yk/polyfill/bits/core_traits.hpp>
+#include <yk/polyfill/bits/invoke.hpp>
+#include <yk/polyfill/bits/tuple_leaf.hpp>
+
+#include <yk/polyfill/utility.hpp>
+
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace yk {
+
+namespace polyfill {
+
+namespace detail {
+
+// The callable and the bound arguments are stored as flat tuple leaves, so empty callables take no space:
+// bind_front(stateless_fn, ptr) is exactly pointer-sized.
+template<class Indices, class F, class... Bound>
+struct bind_storage;
+
+template<std::size_t... Is, class F, class... Bound>
+struct YK_POLYFILL_EMPTY_BASES bind_storage<index_sequence<Is...>, F, Bound...> : tuple_leaf<0, F>, tuple_leaf<Is + 1, Bound>... {
+  template<class G, class... Us>
+  constexpr explicit bind_storage(in_place_t, G&& g, Us&&... us) : tuple_leaf<0, F>(std::forward<G>(g)), tuple_leaf<Is + 1, Bound>(std::forward<Us>(us))...
+  {
+  }
+};
+
+template<class Indices, class F, class... Bound>
+class bind_front_t;
+
+template<std::size_t... Is, class F, class... Bound>
+class bind_front_t<index_sequence<Is...>, F, Bound...> : private bind_storage<index_sequence<Is...>, F, Bound...> {
+  using storage_type = bind_storage<index_sequence<Is...>, F, Bound...>;
+
+  template<class Self, class... Args>
+  YK_POLYFILL_ALWAYS_INLINE static constexpr auto call(Self&& self, Args&&... args) noexcept(noexcept(polyfill::invoke(
+      detail::get_leaf<0>(std::forward<Self>(self)), detail::get_leaf<Is + 1>(std::forward<Self>(self))..., std::forward<Args>(args)...
+  ))) -> decltype(polyfill::invoke(detail::get_leaf<0>(std::forward<Self>(self)), detail::get_leaf<Is + 1>(std::forward<Self>(self))..., std::forward<Args>(args)...))
+  {
+    return polyfill::invoke(detail::get_leaf<0>(std::forward<Self>(self)), detail::get_leaf<Is + 1>(std::forward<Self>(self))..., std::forward<Args>(args)...);
+  }
+
+public:
+  using storage_type::storage_type;
+
+  template<class... Args>
+  YK_POLYFILL_ALWAYS_INLINE YK_POLYFILL_CXX14_CONSTEXPR auto operator()(Args&&... args) & noexcept(noexcept(call(std::declval<storage_type&>(), std::forward<Args>(args)...)))
+      -> decltype(call(std::declval<storage_type&>(), std::forward<Args>(args)...))
+  {
+    return call(static_cast<storage_type&>(*this), std::forward<Args>(args)...);
+  }
+
+  template<class... Args>
+  YK_POLYFILL_ALWAYS_INLINE constexpr auto operator()(Args&&... args) const& noexcept(noexcept(call(std::declval<storage_type const&>(), std::forward<Args>(args)...)))
+      -> decltype(call(std::declval<storage_type const&>(), std::forward<Args>(args)...))
+  {
+    return call(static_cast<storage_type const&>(*this), std::forward<Args>(args)...);
+  }
+
+  template<class... Args>
+  YK_POLYFILL_ALWAYS_INLINE YK_POLYFILL_CXX14_CONSTEXPR auto operator()(Args&&... args) && noexcept(noexcept(call(std::declval<storage_type&&>(), std::forward<Args>(args)...)))
+      -> decltype(call(std::declval<storage_type&&>(), std::forward<Args>(args)...))
+  {
+    return call(static_cast<storage_type&&>(*this), std::forward<Args>(args)...);
+  }
+
+  template<class... Args>
+  YK_POLYFILL_ALWAYS_INLINE constexpr auto operator()(Args&&... args) const&& noexcept(noexcept(call(std::declval<storage_type const&&>(), std::forward<Args>(args)...)))
+      -> decltype(call(std::declval<storage_type const&&>(), std::forward<Args>(args)...))
+  {
+    return call(static_cast<storage_type const&&>(*this), std::forward<Args>(args)...);
+  }
+};
+
+template<class Indices, class F, class... Bound>
+class bind_back_t;
+
+template<std::size_t... Is, class F, class... Bound>
+class bind_back_t<index_sequence<Is...>, F, Bound...> : private bind_storage<index_sequence<Is...>, F, Bound...> {
+  using storage_type = bind_storage<index_sequence<Is...>, F, Bound...>;
+
+  template<class Self, class... Args>
+  YK_POLYFILL_ALWAYS_INLINE static constexpr auto call(Self&& self, Args&&... args) noexcept(noexcept(polyfill::invoke(
+      detail::get_leaf<0>(std::forward<Self>(self)), std::forward<Args>(args)..., detail::get_leaf<Is + 1>(std::forward<Self>(self))...
+  ))) -> decltype(polyfill::invoke(detail::get_leaf<0>(std::forward<Self>(self)), std::forward<Args>(args)..., detail::get_leaf<Is + 1>(std::forward<Self>(self))...))
+  {
+    return polyfill::invoke(detail::get_leaf<0>(std::forward<Self>(self)), std::forward<Args>(args)..., detail::get_leaf<Is + 1>(std::forward<Self>(self))...);
+  }
+
+public:
+  using storage_type::storage_type;
+
+  template<class... Args>
+  YK_POLYFILL_ALWAYS_INLINE YK_POLYFILL_CXX14_CONSTEXPR auto operator()(Args&&... args) & noexcept(noexcept(call(std::declval<storage_type&>(), std::forward<Args>(args)...)))
+      -> decltype(call(std::declval<storage_type&>(), std::forward<Args>(args)...))
+  {
+    return call(static_cast<storage_type&>(*this), std::forward<Args>(args)...);
+  }
+
+  template<class... Args>
+  YK_POLYFILL_ALWAYS_INLINE constexpr auto operator()(Args&&... args) const& noexcept(noexcept(call(std::declval<storage_type const&>(), std::forward<Args>(args)...)))
+      -> decltype(call(std::declval<storage_type const&>(), std::forward<Args>(args)...))
+  {
+    return call(static_cast<storage_type const&>(*this), std::forward<Args>(args)...);
+  }
+
+  template<class... Args>
+  YK_POLYFILL_ALWAYS_INLINE YK_POLYFILL_CXX14_CONSTEXPR auto operator()(Args&&... args) && noexcept(noexcept(call(std::declval<storage_type&&>(), std::forward<Args>(args)...)))
+      -> decltype(call(std::declval<storage_type&&>(), std::forward<Args>(args)...))
+  {
+    return call(static_cast<storage_type&&>(*this), std::forward<Args>(args)...);
+  }
+
+  template<class... Args>
+  YK_POLYFILL_ALWAYS_INLINE constexpr auto operator()(Args&&... args) const&& noexcept(noexcept(call(std::declval<storage_type const&&>(), std::forward<Args>(args)...)))
+      -> decltype(call(std::declval<storage_type const&&>(), std::forward<Args>(args)...))
+  {
+    return call(static_cast<storage_type const&&>(*this), std::forward<Args>(args)...);
+  }
+};
+
+template<class F, class... Args>
+struct is_bindable
+    : conjunction<
+          std::is_constructible<typename std::decay<F>::type, F>, std::is_move_constructible<typename std::decay<F>::type>,
+          std::is_constructible<typename std::decay<Args>::type, Args>..., std::is_move_constructible<typename std::decay<Args>::type>...> {};
+
+}  // namespace detail
+
+// bind_front(f, bound...)(args...) == invoke(f, bound..., args...)
+// f and the bound arguments are decay-copied; the call forwards them with the binder's value category.
+template<class F, class... Args>
+constexpr detail::bind_front_t<make_index_sequence<sizeof...(Args)>, typename std::decay<F>::type, typename std::decay<Args>::type...>
+bind_front(F&& f, Args&&... args)
+{
+  static_assert(detail::is_bindable<F, Args...>::value, "bind_front requires decay-copyable and move constructible arguments");
+  return detail::bind_front_t<make_index_sequence<sizeof...(Args)>, typename std::decay<F>::type, typename std::decay<Args>::type...>(
+      in_place, std::forward<F>(f), std::forward<Args>(args)...
+  );
+}
+
+// bind_back(f, bound...)(args...) == invoke(f, args..., bound...)
+template<class F, class... Args>
+constexpr detail::bind_back_t<make_index_sequence<sizeof...(Args)>, typename std::decay<F>::type, typename std::decay<Args>::type...>
+bind_back(F&& f, Args&&... args)
+{
+  static_assert(detail::is_bindable<F, Args...>::value, "bind_back requires decay-copyable and move constructible arguments");
+  return detail::bind_back_t<make_index_sequence<sizeof...(Args)>, typename std::decay<F>::type, typename std::decay<Args>::type...>(
+      in_place, std::forward<F>(f), std::forward<Args>(args)...
+  );
+}
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+#endif  // YK_ZZ_POLYFILL_BITS_BIND_HPP
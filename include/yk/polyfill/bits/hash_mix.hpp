@@ -0,0 +1,53 @@
+#ifndef YK_ZZ_POLYFILL_BITS_HASH_MIX_HPP
+#define YK_ZZ_POLYFILL_BITS_HASH_MIX_HPP
+
+// Cheap hash mixing shared by the std::hash specializations of sum types.
+// A salt (e.g. an alternative index) is folded into an existing hash with one multiply-xorshift round
+// instead of hashing it separately and combining two full hashes.
+
+#include <yk/polyfill/config.hpp>
+
+#include <cstddef>
+
+namespace yk {
+
+namespace polyfill {
+
+namespace detail {
+
+template<std::size_t SizeofSizeT = sizeof(std::size_t)>
+struct hash_mix_constants {
+  // 32-bit size_t
+  static constexpr std::size_t golden = static_cast<std::size_t>(0x9e3779b9UL);
+  static constexpr std::size_t multiplier = static_cast<std::size_t>(0x85ebca6bUL);
+  static constexpr unsigned shift = 16;
+};
+
+template<>
+struct hash_mix_constants<8> {
+  static constexpr std::size_t golden = static_cast<std::size_t>(0x9e3779b97f4a7c15ULL);
+  static constexpr std::size_t multiplier = static_cast<std::size_t>(0xbf58476d1ce4e5b9ULL);
+  static constexpr unsigned shift = 32;
+};
+
+constexpr std::size_t hash_xorshift(std::size_t x) noexcept { return x ^ (x >> hash_mix_constants<>::shift); }
+
+// When `salt` is a constant (as it is for an index coming from raw_visit), `salt * golden` folds away,
+// leaving a single add, multiply and xorshift on the hot path.
+constexpr std::size_t hash_mix(std::size_t h, std::size_t salt) noexcept
+{
+  return hash_xorshift((h + salt * hash_mix_constants<>::golden) * hash_mix_constants<>::multiplier);
+}
+
+// Fixed hashes for states without a value (disengaged optional, valueless variant, monostate).
+YK_POLYFILL_INLINE constexpr std::size_t hash_disengaged = static_cast<std::size_t>(0x2545f4914f6cdd1dULL);
+YK_POLYFILL_INLINE constexpr std::size_t hash_valueless = static_cast<std::size_t>(0x9fb21c651e98df25ULL);
+YK_POLYFILL_INLINE constexpr std::size_t hash_monostate = static_cast<std::size_t>(0xd6e8feb86659fd93ULL);
+
+}  // namespace detail
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+#endif  // YK_ZZ_POLYFILL_BITS_HASH_MIX_HPP
@@ -23,7 +23,7 @@ struct is_reference_wrapper<std::reference_wrapper<T>> : true_type {};
 
 // normal case
 template<class F, class... Args, typename std::enable_if<!std::is_member_pointer<F>::value, std::nullptr_t>::type = nullptr>
-constexpr auto invoke_impl(F&& f, Args&&... args) noexcept(noexcept(std::forward<F>(f)(std::forward<Args>(args)...)))
+YK_POLYFILL_ALWAYS_INLINE constexpr auto invoke_impl(F&& f, Args&&... args) noexcept(noexcept(std::forward<F>(f)(std::forward<Args>(args)...)))
     -> decltype(std::forward<F>(f)(std::forward<Args>(args)...))
 {
   return std::forward<F>(f)(std::forward<Args>(args)...);
@@ -61,7 +61,7 @@ struct check_invoke_kind<
 template<
     class T, class C, class U,
     typename std::enable_if<check_invoke_kind<C, typename remove_cvref<U>::type>::value == invoke_kind::reference_to_object, std::nullptr_t>::type = nullptr>
-constexpr auto invoke_impl(T C::* f, U&& u) noexcept -> decltype(std::forward<U>(u).*f)
+YK_POLYFILL_ALWAYS_INLINE constexpr auto invoke_impl(T C::* f, U&& u) noexcept -> decltype(std::forward<U>(u).*f)
 {
   return std::forward<U>(u).*f;
 }
@@ -70,7 +70,7 @@ constexpr auto invoke_impl(T C::* f, U&& u) noexcept -> decltype(std::forward<U>
 template<
     class T, class C, class U,
     typename std::enable_if<check_invoke_kind<C, typename remove_cvref<U>::type>::value == invoke_kind::reference_wrapper, std::nullptr_t>::type = nullptr>
-constexpr auto invoke_impl(T C::* f, U&& u) noexcept -> decltype(std::forward<U>(u).get().*f)
+YK_POLYFILL_ALWAYS_INLINE constexpr auto invoke_impl(T C::* f, U&& u) noexcept -> decltype(std::forward<U>(u).get().*f)
 {
   return std::forward<U>(u).get().*f;
 }
@@ -79,7 +79,7 @@ constexpr auto invoke_impl(T C::* f, U&& u) noexcept -> decltype(std::forward<U>
 template<
     class T, class C, class U,
     typename std::enable_if<check_invoke_kind<C, typename remove_cvref<U>::type>::value == invoke_kind::dereferenceable, std::nullptr_t>::type = nullptr>
-constexpr auto invoke_impl(T C::* f, U&& u) noexcept(noexcept((*std::forward<U>(u)).*f)) -> decltype((*std::forward<U>(u)).*f)
+YK_POLYFILL_ALWAYS_INLINE constexpr auto invoke_impl(T C::* f, U&& u) noexcept(noexcept((*std::forward<U>(u)).*f)) -> decltype((*std::forward<U>(u)).*f)
 {
   return (*std::forward<U>(u)).*f;
 }
@@ -134,7 +134,7 @@ template<
         check_invoke_kind<typename get_class_from_member_function_pointer<MFP>::type, typename remove_cvref<U>::type>::value
             == invoke_kind::reference_to_object,
         std::nullptr_t>::type = nullptr>
-constexpr auto invoke_impl(MFP mfp, U&& u, Args&&... args) noexcept(noexcept((std::forward<U>(u).*mfp)(std::forward<Args>(args)...)))
+YK_POLYFILL_ALWAYS_INLINE constexpr auto invoke_impl(MFP mfp, U&& u, Args&&... args) noexcept(noexcept((std::forward<U>(u).*mfp)(std::forward<Args>(args)...)))
     -> decltype((std::forward<U>(u).*mfp)(std::forward<Args>(args)...))
 {
   return (std::forward<U>(u).*mfp)(std::forward<Args>(args)...);
@@ -146,7 +146,7 @@ template<
     typename std::enable_if<
         check_invoke_kind<typename get_class_from_member_function_pointer<MFP>::type, typename remove_cvref<U>::type>::value == invoke_kind::reference_wrapper,
         std::nullptr_t>::type = nullptr>
-constexpr auto invoke_impl(MFP mfp, U&& u, Args&&... args) noexcept(noexcept((std::forward<U>(u).get().*mfp)(std::forward<Args>(args)...)))
+YK_POLYFILL_ALWAYS_INLINE constexpr auto invoke_impl(MFP mfp, U&& u, Args&&... args) noexcept(noexcept((std::forward<U>(u).get().*mfp)(std::forward<Args>(args)...)))
     -> decltype((std::forward<U>(u).get().*mfp)(std::forward<Args>(args)...))
 {
   return (std::forward<U>(u).get().*mfp)(std::forward<Args>(args)...);
@@ -158,7 +158,7 @@ template<
     typename std::enable_if<
         check_invoke_kind<typename get_class_from_member_function_pointer<MFP>::type, typename remove_cvref<U>::type>::value == invoke_kind::dereferenceable,
         std::nullptr_t>::type = nullptr>
-constexpr auto invoke_impl(MFP mfp, U&& u, Args&&... args) noexcept(noexcept(((*std::forward<U>(u)).*mfp)(std::forward<Args>(args)...)))
+YK_POLYFILL_ALWAYS_INLINE constexpr auto invoke_impl(MFP mfp, U&& u, Args&&... args) noexcept(noexcept(((*std::forward<U>(u)).*mfp)(std::forward<Args>(args)...)))
     -> decltype(((*std::forward<U>(u)).*mfp)(std::forward<Args>(args)...))
 {
   return ((*std::forward<U>(u)).*mfp)(std::forward<Args>(args)...);
@@ -167,7 +167,7 @@ constexpr auto invoke_impl(MFP mfp, U&& u, Args&&... args) noexcept(noexcept(((*
 template<class R>
 struct invoke_r_impl {
   template<class F, class... Args>
-  static constexpr R apply(F&& f, Args&&... args) noexcept(
+  YK_POLYFILL_ALWAYS_INLINE static constexpr R apply(F&& f, Args&&... args) noexcept(
       noexcept(detail::invoke_impl(std::forward<F>(f), std::forward<Args>(args)...))
       && is_nothrow_convertible<decltype(detail::invoke_impl(std::forward<F>(f), std::forward<Args>(args)...)), R>::value
   )
@@ -179,7 +179,7 @@ struct invoke_r_impl {
 template<>
 struct invoke_r_impl<void> {
   template<class F, class... Args>
-  static YK_POLYFILL_CXX14_CONSTEXPR void apply(F&& f, Args&&... args) noexcept(noexcept(detail::invoke_impl(std::forward<F>(f), std::forward<Args>(args)...)))
+  YK_POLYFILL_ALWAYS_INLINE static YK_POLYFILL_CXX14_CONSTEXPR void apply(F&& f, Args&&... args) noexcept(noexcept(detail::invoke_impl(std::forward<F>(f), std::forward<Args>(args)...)))
   {
     static_cast<void>(detail::invoke_impl(std::forward<F>(f), std::forward<Args>(args)...));
   }
@@ -249,14 +249,23 @@ struct is_nothrow_invocable_r : detail::is_nothrow_invocable_r_impl<R, F, void,
 template<class F, class... Args>
 struct invoke_result : detail::invoke_result_impl<F, void, Args...> {};
 
-template<class F, class... Args>
-constexpr typename invoke_result<F, Args...>::type invoke(F&& f, Args&&... args) noexcept(is_nothrow_invocable<F, Args...>::value)
+// plain function objects, function pointers and references: called directly, without going through invoke_impl
+template<class F, class... Args, typename std::enable_if<!std::is_member_pointer<typename remove_cvref<F>::type>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_ALWAYS_INLINE constexpr auto invoke(F&& f, Args&&... args) noexcept(noexcept(std::forward<F>(f)(std::forward<Args>(args)...)))
+    -> decltype(std::forward<F>(f)(std::forward<Args>(args)...))
+{
+  return std::forward<F>(f)(std::forward<Args>(args)...);
+}
+
+// pointers to members
+template<class F, class... Args, typename std::enable_if<std::is_member_pointer<typename remove_cvref<F>::type>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_ALWAYS_INLINE constexpr typename invoke_result<F, Args...>::type invoke(F&& f, Args&&... args) noexcept(is_nothrow_invocable<F, Args...>::value)
 {
   return detail::invoke_impl(std::forward<F>(f), std::forward<Args>(args)...);
 }
 
 template<class R, class F, class... Args>
-constexpr R invoke_r(F&& f, Args&&... args) noexcept(is_nothrow_invocable_r<R, F, Args...>::value)
+YK_POLYFILL_ALWAYS_INLINE constexpr R invoke_r(F&& f, Args&&... args) noexcept(is_nothrow_invocable_r<R, F, Args...>::value)
 {
   return detail::invoke_r_impl<R>::apply(std::forward<F>(f), std::forward<Args>(args)...);
 }
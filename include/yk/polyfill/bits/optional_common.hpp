@@ -33,6 +33,30 @@ struct converts_from_any_cvref {
       std::is_constructible<T, W&&>, std::is_convertible<W&&, T>, std::is_constructible<T, W const&&>, std::is_convertible<W const&&, T>>::value;
 };
 
+// reference_constructs_from_temporary<R, U>: binding R to an expression of type U would materialize a temporary.
+// Without the builtin, only the common case of a `T const&` bound to a non-lvalue T (or derived) is caught.
+#if defined(__has_builtin)
+#if __has_builtin(__reference_constructs_from_temporary)
+#define YK_POLYFILL_DETAIL_HAS_REFERENCE_CONSTRUCTS_FROM_TEMPORARY 1
+#endif
+#endif
+
+#if defined(YK_POLYFILL_DETAIL_HAS_REFERENCE_CONSTRUCTS_FROM_TEMPORARY)
+template<class R, class U>
+struct reference_constructs_from_temporary : bool_constant<__reference_constructs_from_temporary(R, U)> {};
+#else
+template<class R, class U>
+struct reference_constructs_from_temporary
+    : bool_constant<
+          std::is_lvalue_reference<R>::value && !std::is_lvalue_reference<U>::value
+          && std::is_const<typename std::remove_reference<R>::type>::value && !std::is_volatile<typename std::remove_reference<R>::type>::value
+          && (std::is_same<typename remove_cvref<R>::type, typename remove_cvref<U>::type>::value
+              || std::is_base_of<typename remove_cvref<R>::type, typename remove_cvref<U>::type>::value
+              || (std::is_scalar<typename remove_cvref<R>::type>::value && std::is_scalar<typename remove_cvref<U>::type>::value
+                  && std::is_convertible<U, typename remove_cvref<R>::type>::value))> {};
+#endif
+#undef YK_POLYFILL_DETAIL_HAS_REFERENCE_CONSTRUCTS_FROM_TEMPORARY
+
 }  // namespace detail
 
 }  // namespace polyfill
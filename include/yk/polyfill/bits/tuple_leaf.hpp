@@ -0,0 +1,95 @@
+#ifndef YK_ZZ_POLYFILL_BITS_TUPLE_LEAF_HPP
+#define YK_ZZ_POLYFILL_BITS_TUPLE_LEAF_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <yk/polyfill/extension/ebo_storage.hpp>
+
+#include <type_traits>
+
+#include <cstddef>
+
+namespace yk {
+
+namespace polyfill {
+
+namespace detail {
+
+// tuple_leaf<I, T>: storage for the I-th element of a flat tuple.
+// A tuple inherits all of its leaves from a single pack expansion, so reaching an element is one derived-to-base
+// conversion instead of a walk down a recursive base chain. Empty elements are stored through ebo_storage.
+template<std::size_t I, class T>
+struct tuple_leaf : extension::ebo_storage<T> {
+  using extension::ebo_storage<T>::ebo_storage;
+  tuple_leaf() = default;
+};
+
+// stands in for the parameter of an assignment operator that must not exist
+struct tuple_leaf_nonesuch {
+  tuple_leaf_nonesuch() = delete;
+  ~tuple_leaf_nonesuch() = delete;
+  tuple_leaf_nonesuch(tuple_leaf_nonesuch const&) = delete;
+  void operator=(tuple_leaf_nonesuch const&) = delete;
+};
+
+// A reference leaf assigns through to the referred-to object, as std::tuple does; the implicit assignment would be deleted.
+template<std::size_t I, class T>
+struct tuple_leaf<I, T&> : extension::ebo_storage<T&> {
+  using extension::ebo_storage<T&>::ebo_storage;
+  tuple_leaf() = default;
+  tuple_leaf(tuple_leaf const&) = default;
+
+  YK_POLYFILL_CXX14_CONSTEXPR tuple_leaf&
+  operator=(typename std::conditional<std::is_copy_assignable<T>::value, tuple_leaf const&, tuple_leaf_nonesuch const&>::type other
+  ) noexcept(std::is_nothrow_copy_assignable<T>::value)
+  {
+    this->stored_value() = other.stored_value();
+    return *this;
+  }
+};
+
+// I is given, T is deduced from the unique base tuple_leaf<I, T>
+template<std::size_t I, class T>
+YK_POLYFILL_ALWAYS_INLINE YK_POLYFILL_CXX14_CONSTEXPR T& get_leaf(tuple_leaf<I, T>& leaf) noexcept
+{
+  return leaf.stored_value();
+}
+
+template<std::size_t I, class T>
+YK_POLYFILL_ALWAYS_INLINE constexpr T const& get_leaf(tuple_leaf<I, T> const& leaf) noexcept
+{
+  return leaf.stored_value();
+}
+
+template<std::size_t I, class T>
+YK_POLYFILL_ALWAYS_INLINE YK_POLYFILL_CXX14_CONSTEXPR T&& get_leaf(tuple_leaf<I, T>&& leaf) noexcept
+{
+  return static_cast<T&&>(leaf.stored_value());
+}
+
+template<std::size_t I, class T>
+YK_POLYFILL_ALWAYS_INLINE constexpr T const&& get_leaf(tuple_leaf<I, T> const&& leaf) noexcept
+{
+  return static_cast<T const&&>(leaf.stored_value());
+}
+
+// T is given, I is deduced; deduction fails unless exactly one leaf holds a T
+template<class T, std::size_t I>
+YK_POLYFILL_ALWAYS_INLINE YK_POLYFILL_CXX14_CONSTEXPR T& get_leaf_by_type(tuple_leaf<I, T>& leaf) noexcept
+{
+  return leaf.stored_value();
+}
+
+template<class T, std::size_t I>
+YK_POLYFILL_ALWAYS_INLINE constexpr T const& get_leaf_by_type(tuple_leaf<I, T> const& leaf) noexcept
+{
+  return leaf.stored_value();
+}
+
+}  // namespace detail
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+#endif  // YK_ZZ_POLYFILL_BITS_TUPLE_LEAF_HPP
@@ -60,6 +60,31 @@
 #define YK_POLYFILL_CXX20_CONSTEXPR_VDESTROY YK_POLYFILL_CXX20_CONSTEXPR
 #endif
 
+// Branch prediction hints usable inside expressions (C++11 constexpr functions included)
+#if defined(__GNUC__) || defined(__clang__)
+#define YK_POLYFILL_LIKELY(...) (__builtin_expect(static_cast<bool>(__VA_ARGS__), 1))
+#define YK_POLYFILL_UNLIKELY(...) (__builtin_expect(static_cast<bool>(__VA_ARGS__), 0))
+#else
+#define YK_POLYFILL_LIKELY(...) (static_cast<bool>(__VA_ARGS__))
+#define YK_POLYFILL_UNLIKELY(...) (static_cast<bool>(__VA_ARGS__))
+#endif
+
+// Thin forwarding layers (invoke and friends) are inlined even in unoptimized builds, so they cost no stack frame
+#if defined(__GNUC__) || defined(__clang__)
+#define YK_POLYFILL_ALWAYS_INLINE __attribute__((always_inline)) inline
+#elif defined(_MSC_VER)
+#define YK_POLYFILL_ALWAYS_INLINE __forceinline
+#else
+#define YK_POLYFILL_ALWAYS_INLINE inline
+#endif
+
+// MSVC only applies the empty base optimization to the first empty base unless asked to
+#if defined(_MSC_VER)
+#define YK_POLYFILL_EMPTY_BASES __declspec(empty_bases)
+#else
+#define YK_POLYFILL_EMPTY_BASES
+#endif
+
 #if YK_POLYFILL_CXX_VERSION >= 201703L
 #define YK_POLYFILL_NODISCARD [[nodiscard]]
 #else
@@ -0,0 +1,205 @@
+#ifndef YK_ZZ_POLYFILL_EXTENSION_ALLOCATE_UNIQUE_HPP
+#define YK_ZZ_POLYFILL_EXTENSION_ALLOCATE_UNIQUE_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <yk/polyfill/bits/core_traits.hpp>
+
+#include <yk/polyfill/extension/ebo_storage.hpp>
+
+#include <yk/polyfill/memory.hpp>
+#include <yk/polyfill/type_traits.hpp>
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+// allocator_delete<T, Alloc>: deleter that destroys and deallocates through a (rebound) copy of `Alloc`.
+// The allocator is stored via ebo_storage, so a stateless allocator adds nothing to the unique_ptr.
+
+template<class T, class Alloc>
+class allocator_delete : ebo_storage<typename std::allocator_traits<Alloc>::template rebind_alloc<typename std::remove_cv<T>::type>> {
+  using alloc_base = ebo_storage<typename std::allocator_traits<Alloc>::template rebind_alloc<typename std::remove_cv<T>::type>>;
+
+public:
+  using allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<typename std::remove_cv<T>::type>;
+  using pointer = typename std::allocator_traits<allocator_type>::pointer;
+
+  template<class A = allocator_type, typename std::enable_if<std::is_default_constructible<A>::value, std::nullptr_t>::type = nullptr>
+  constexpr allocator_delete() noexcept(std::is_nothrow_default_constructible<A>::value) : alloc_base()
+  {
+  }
+
+  template<class A, typename std::enable_if<std::is_constructible<allocator_type, A const&>::value, std::nullptr_t>::type = nullptr>
+  constexpr explicit allocator_delete(A const& a) noexcept : alloc_base(allocator_type(a))
+  {
+  }
+
+  YK_POLYFILL_CXX20_CONSTEXPR void operator()(pointer p) noexcept
+  {
+    using alloc_traits = std::allocator_traits<allocator_type>;
+    alloc_traits::destroy(alloc_base::stored_value(), std::addressof(*p));
+    alloc_traits::deallocate(alloc_base::stored_value(), p, 1);
+  }
+
+  constexpr allocator_type const& get_allocator() const noexcept { return alloc_base::stored_value(); }
+  YK_POLYFILL_CXX14_CONSTEXPR allocator_type& get_allocator() noexcept { return alloc_base::stored_value(); }
+};
+
+// Array form: also remembers the element count, since deallocate() needs it and unique_ptr<T[]> does not keep it.
+// reset() on the owning unique_ptr must therefore only be given arrays of the same length.
+
+template<class T, class Alloc>
+class allocator_delete<T[], Alloc> : ebo_storage<typename std::allocator_traits<Alloc>::template rebind_alloc<typename std::remove_cv<T>::type>> {
+  using alloc_base = ebo_storage<typename std::allocator_traits<Alloc>::template rebind_alloc<typename std::remove_cv<T>::type>>;
+
+public:
+  using allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<typename std::remove_cv<T>::type>;
+  using pointer = typename std::allocator_traits<allocator_type>::pointer;
+  using size_type = typename std::allocator_traits<allocator_type>::size_type;
+
+  template<class A = allocator_type, typename std::enable_if<std::is_default_constructible<A>::value, std::nullptr_t>::type = nullptr>
+  constexpr allocator_delete() noexcept(std::is_nothrow_default_constructible<A>::value) : alloc_base(), size_(0)
+  {
+  }
+
+  template<class A, typename std::enable_if<std::is_constructible<allocator_type, A const&>::value, std::nullptr_t>::type = nullptr>
+  constexpr allocator_delete(A const& a, size_type n) noexcept : alloc_base(allocator_type(a)), size_(n)
+  {
+  }
+
+  YK_POLYFILL_CXX20_CONSTEXPR void operator()(pointer p) noexcept
+  {
+    using alloc_traits = std::allocator_traits<allocator_type>;
+    for (size_type i = size_; i != 0; --i) {
+      alloc_traits::destroy(alloc_base::stored_value(), std::addressof(p[i - 1]));
+    }
+    alloc_traits::deallocate(alloc_base::stored_value(), p, size_);
+  }
+
+  constexpr allocator_type const& get_allocator() const noexcept { return alloc_base::stored_value(); }
+  YK_POLYFILL_CXX14_CONSTEXPR allocator_type& get_allocator() noexcept { return alloc_base::stored_value(); }
+
+  constexpr size_type size() const noexcept { return size_; }
+
+private:
+  size_type size_;
+};
+
+namespace detail {
+
+struct value_init_tag {};
+struct default_init_tag {};
+
+template<class Alloc, class Pointer>
+YK_POLYFILL_CXX20_CONSTEXPR void allocator_construct_one(Alloc& a, Pointer p, value_init_tag)
+{
+  std::allocator_traits<Alloc>::construct(a, std::addressof(*p));
+}
+
+template<class Alloc, class Pointer>
+void allocator_construct_one(Alloc&, Pointer p, default_init_tag)
+{
+  using T = typename std::allocator_traits<Alloc>::value_type;
+  ::new (static_cast<void*>(std::addressof(*p))) T;
+}
+
+// Allocates `n` elements and initializes each one; on exception, already-constructed elements are destroyed and the storage is returned.
+template<class T, class Alloc, class Tag>
+YK_POLYFILL_CXX20_CONSTEXPR unique_ptr<T[], allocator_delete<T[], Alloc>> allocate_unique_array(Alloc const& alloc, std::size_t n, Tag tag)
+{
+  using deleter = allocator_delete<T[], Alloc>;
+  using alloc_traits = std::allocator_traits<typename deleter::allocator_type>;
+
+  typename deleter::allocator_type a(alloc);
+  typename alloc_traits::pointer p = alloc_traits::allocate(a, n);
+  std::size_t i = 0;
+  try {
+    for (; i != n; ++i) {
+      detail::allocator_construct_one(a, p + i, tag);
+    }
+  } catch (...) {
+    while (i != 0) {
+      --i;
+      alloc_traits::destroy(a, std::addressof(p[i]));
+    }
+    alloc_traits::deallocate(a, p, n);
+    throw;
+  }
+  return unique_ptr<T[], deleter>(p, deleter(a, n));
+}
+
+}  // namespace detail
+
+// allocate_unique<T>(alloc, args...): like make_unique, but storage comes from `alloc`
+
+template<class T, class Alloc, class... Args, typename std::enable_if<!std::is_array<T>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_NODISCARD YK_POLYFILL_CXX20_CONSTEXPR unique_ptr<T, allocator_delete<T, Alloc>> allocate_unique(Alloc const& alloc, Args&&... args)
+{
+  using deleter = allocator_delete<T, Alloc>;
+  using alloc_traits = std::allocator_traits<typename deleter::allocator_type>;
+
+  typename deleter::allocator_type a(alloc);
+  typename alloc_traits::pointer p = alloc_traits::allocate(a, 1);
+  try {
+    alloc_traits::construct(a, std::addressof(*p), std::forward<Args>(args)...);
+  } catch (...) {
+    alloc_traits::deallocate(a, p, 1);
+    throw;
+  }
+  return unique_ptr<T, deleter>(p, deleter(a));
+}
+
+template<class T, class Alloc, typename std::enable_if<is_unbounded_array<T>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_NODISCARD YK_POLYFILL_CXX20_CONSTEXPR unique_ptr<T, allocator_delete<T, Alloc>> allocate_unique(Alloc const& alloc, std::size_t n)
+{
+  return detail::allocate_unique_array<typename std::remove_extent<T>::type>(alloc, n, detail::value_init_tag{});
+}
+
+template<class T, class Alloc, class... Args, typename std::enable_if<is_bounded_array<T>::value, std::nullptr_t>::type = nullptr>
+void allocate_unique(Alloc const&, Args&&...) = delete;
+
+// allocate_unique_for_overwrite: default-initializes (bypassing allocator construct), so trivial types are left uninitialized
+
+template<class T, class Alloc, typename std::enable_if<!std::is_array<T>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_NODISCARD unique_ptr<T, allocator_delete<T, Alloc>> allocate_unique_for_overwrite(Alloc const& alloc)
+{
+  using deleter = allocator_delete<T, Alloc>;
+  using alloc_traits = std::allocator_traits<typename deleter::allocator_type>;
+
+  typename deleter::allocator_type a(alloc);
+  typename alloc_traits::pointer p = alloc_traits::allocate(a, 1);
+  try {
+    detail::allocator_construct_one(a, p, detail::default_init_tag{});
+  } catch (...) {
+    alloc_traits::deallocate(a, p, 1);
+    throw;
+  }
+  return unique_ptr<T, deleter>(p, deleter(a));
+}
+
+template<class T, class Alloc, typename std::enable_if<is_unbounded_array<T>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_NODISCARD unique_ptr<T, allocator_delete<T, Alloc>> allocate_unique_for_overwrite(Alloc const& alloc, std::size_t n)
+{
+  return detail::allocate_unique_array<typename std::remove_extent<T>::type>(alloc, n, detail::default_init_tag{});
+}
+
+template<class T, class Alloc, class... Args, typename std::enable_if<is_bounded_array<T>::value, std::nullptr_t>::type = nullptr>
+void allocate_unique_for_overwrite(Alloc const&, Args&&...) = delete;
+
+}  // namespace extension
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+#endif  // YK_ZZ_POLYFILL_EXTENSION_ALLOCATE_UNIQUE_HPP
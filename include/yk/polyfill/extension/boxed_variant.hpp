@@ -0,0 +1,421 @@
+#ifndef YK_ZZ_POLYFILL_EXTENSION_BOXED_VARIANT_HPP
+#define YK_ZZ_POLYFILL_EXTENSION_BOXED_VARIANT_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <yk/polyfill/bits/core_traits.hpp>
+
+#include <yk/polyfill/extension/pack_indexing.hpp>
+
+#include <yk/polyfill/functional.hpp>
+#include <yk/polyfill/indirect.hpp>
+#include <yk/polyfill/type_traits.hpp>
+#include <yk/polyfill/utility.hpp>
+#include <yk/polyfill/variant.hpp>
+
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+// boxed<T, A>: marks an alternative of boxed_variant as heap-allocated.
+// The variant stores indirect<T, A> for it, so a rarely used large alternative no longer sets the size of every element.
+template<class T, class A = std::allocator<T>>
+struct boxed {};
+
+namespace detail {
+
+template<class T>
+struct box_traits {
+  using value_type = T;
+  using storage_type = T;
+  using is_boxed = false_type;
+};
+
+template<class T, class A>
+struct box_traits<boxed<T, A>> {
+  using value_type = T;
+  using storage_type = indirect<T, A>;
+  using is_boxed = true_type;
+};
+
+// Maps a stored alternative back to what users see. Keyed on the storage type, which is unambiguous because
+// boxed_variant rejects indirect<T, A> listed as a plain alternative.
+template<class Storage>
+struct unboxer {
+  template<class S>
+  static constexpr S&& apply(S&& s) noexcept
+  {
+    return std::forward<S>(s);
+  }
+};
+
+template<class T, class A>
+struct unboxer<indirect<T, A>> {
+  template<class S>
+  static YK_POLYFILL_CXX14_CONSTEXPR auto apply(S&& s) noexcept -> decltype(*std::forward<S>(s))
+  {
+    return *std::forward<S>(s);
+  }
+};
+
+template<class S>
+YK_POLYFILL_CXX14_CONSTEXPR auto unbox(S&& s) noexcept -> decltype(unboxer<typename remove_cvref<S>::type>::apply(std::forward<S>(s)))
+{
+  return unboxer<typename remove_cvref<S>::type>::apply(std::forward<S>(s));
+}
+
+template<class Visitor>
+struct unboxing_visitor {
+  Visitor&& vis;
+
+  template<class... Args>
+  YK_POLYFILL_CXX14_CONSTEXPR auto operator()(Args&&... args) const
+      -> decltype(polyfill::invoke(std::forward<Visitor>(vis), detail::unbox(std::forward<Args>(args))...))
+  {
+    return polyfill::invoke(std::forward<Visitor>(vis), detail::unbox(std::forward<Args>(args))...);
+  }
+};
+
+struct boxed_variant_access {
+  template<class V>
+  static constexpr auto base(V&& v) noexcept -> decltype((std::forward<V>(v).v_))
+  {
+    return std::forward<V>(v).v_;
+  }
+};
+
+template<class T>
+struct is_boxed_variant;
+
+}  // namespace detail
+
+// boxed_variant<Ts...>: variant whose boxed<T> alternatives live on the heap.
+// get/get_if/holds_alternative/visit take and return the unboxed T, so callers never see the indirect.
+// A moved-from boxed alternative is left without a value (as indirect is); it may only be assigned to or destroyed.
+template<class... Ts>
+class boxed_variant {
+  static_assert(sizeof...(Ts) > 0, "boxed_variant must be instantiated with at least one type template parameter");
+  static_assert(!disjunction<polyfill::detail::is_indirect<Ts>...>::value, "use boxed<T> instead of listing indirect<T> as an alternative");
+
+public:
+  using variant_type = variant<typename detail::box_traits<Ts>::storage_type...>;
+
+private:
+  template<std::size_t I>
+  using traits = detail::box_traits<typename pack_indexing<I, Ts...>::type>;
+
+  template<std::size_t I>
+  using value_t = typename traits<I>::value_type;
+
+  friend struct detail::boxed_variant_access;
+
+  variant_type v_;
+
+  template<std::size_t I, class... Args>
+  boxed_variant(true_type /* is_boxed */, in_place_index_t<I> ipi, Args&&... args) : v_(ipi, in_place_t{}, std::forward<Args>(args)...)
+  {
+  }
+
+  template<std::size_t I, class... Args>
+  constexpr boxed_variant(false_type /* is_boxed */, in_place_index_t<I> ipi, Args&&... args) : v_(ipi, std::forward<Args>(args)...)
+  {
+  }
+
+  template<std::size_t I, class... Args>
+  YK_POLYFILL_CXX20_CONSTEXPR value_t<I>& do_emplace(true_type /* is_boxed */, Args&&... args)
+  {
+    return *v_.template emplace<I>(in_place_t{}, std::forward<Args>(args)...);
+  }
+
+  template<std::size_t I, class... Args>
+  YK_POLYFILL_CXX20_CONSTEXPR value_t<I>& do_emplace(false_type /* is_boxed */, Args&&... args)
+  {
+    return v_.template emplace<I>(std::forward<Args>(args)...);
+  }
+
+  template<std::size_t I, class U>
+  YK_POLYFILL_CXX20_CONSTEXPR void do_assign(true_type /* is_boxed */, U&& u)
+  {
+    auto& box = polyfill::get<I>(v_);
+    if (box.valueless_after_move()) {
+      // nothing to assign through; give the box a fresh value with its own allocator
+      box = typename traits<I>::storage_type(std::allocator_arg, box.get_allocator(), in_place_t{}, std::forward<U>(u));
+    } else {
+      *box = std::forward<U>(u);
+    }
+  }
+
+  template<std::size_t I, class U>
+  YK_POLYFILL_CXX20_CONSTEXPR void do_assign(false_type /* is_boxed */, U&& u)
+  {
+    polyfill::get<I>(v_) = std::forward<U>(u);
+  }
+
+public:
+  template<
+      class Head = value_t<0>, typename std::enable_if<std::is_default_constructible<Head>::value, std::nullptr_t>::type = nullptr>
+  constexpr boxed_variant() : boxed_variant(typename traits<0>::is_boxed{}, in_place_index_t<0>{})
+  {
+  }
+
+  template<
+      class U, typename std::enable_if<!std::is_same<typename remove_cvref<U>::type, boxed_variant>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<!polyfill::detail::is_in_place_type<typename remove_cvref<U>::type>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<!polyfill::detail::is_in_place_index<typename remove_cvref<U>::type>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<
+          polyfill::detail::is_invocation_to_imaginary_function_set_valid<U, typename detail::box_traits<Ts>::value_type...>::value,
+          std::nullptr_t>::type = nullptr,
+      std::size_t SelectedIndex = polyfill::detail::select_alternative<U, typename detail::box_traits<Ts>::value_type...>::value,
+      typename std::enable_if<std::is_constructible<value_t<SelectedIndex>, U>::value, std::nullptr_t>::type = nullptr>
+  constexpr boxed_variant(U&& u)
+      : boxed_variant(typename traits<SelectedIndex>::is_boxed{}, in_place_index_t<SelectedIndex>{}, std::forward<U>(u))
+  {
+  }
+
+  template<
+      std::size_t I, class... Args,
+      typename std::enable_if<std::is_constructible<value_t<I>, Args...>::value, std::nullptr_t>::type = nullptr>
+  constexpr explicit boxed_variant(in_place_index_t<I> ipi, Args&&... args) : boxed_variant(typename traits<I>::is_boxed{}, ipi, std::forward<Args>(args)...)
+  {
+  }
+
+  template<
+      class T, class... Args,
+      typename std::enable_if<polyfill::detail::exactly_once<T, typename detail::box_traits<Ts>::value_type...>::value, std::nullptr_t>::type = nullptr,
+      std::size_t I = polyfill::detail::find_index<T, typename detail::box_traits<Ts>::value_type...>::value,
+      typename std::enable_if<std::is_constructible<T, Args...>::value, std::nullptr_t>::type = nullptr>
+  constexpr explicit boxed_variant(in_place_type_t<T>, Args&&... args)
+      : boxed_variant(typename traits<I>::is_boxed{}, in_place_index_t<I>{}, std::forward<Args>(args)...)
+  {
+  }
+
+  template<
+      class U, typename std::enable_if<!std::is_same<typename remove_cvref<U>::type, boxed_variant>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<
+          polyfill::detail::is_invocation_to_imaginary_function_set_valid<U, typename detail::box_traits<Ts>::value_type...>::value,
+          std::nullptr_t>::type = nullptr,
+      std::size_t SelectedIndex = polyfill::detail::select_alternative<U, typename detail::box_traits<Ts>::value_type...>::value,
+      typename std::enable_if<
+          conjunction<std::is_assignable<value_t<SelectedIndex>&, U>, std::is_constructible<value_t<SelectedIndex>, U>>::value,
+          std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX20_CONSTEXPR boxed_variant& operator=(U&& u)
+  {
+    // Assigning to the active alternative reuses its (possibly heap) storage.
+    if (v_.index() == SelectedIndex) {
+      do_assign<SelectedIndex>(typename traits<SelectedIndex>::is_boxed{}, std::forward<U>(u));
+    } else {
+      do_emplace<SelectedIndex>(typename traits<SelectedIndex>::is_boxed{}, std::forward<U>(u));
+    }
+    return *this;
+  }
+
+  template<
+      std::size_t I, class... Args,
+      typename std::enable_if<std::is_constructible<value_t<I>, Args...>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX20_CONSTEXPR value_t<I>& emplace(Args&&... args)
+  {
+    return do_emplace<I>(typename traits<I>::is_boxed{}, std::forward<Args>(args)...);
+  }
+
+  template<
+      std::size_t I, class U, class... Args,
+      typename std::enable_if<std::is_constructible<value_t<I>, std::initializer_list<U>&, Args...>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX20_CONSTEXPR value_t<I>& emplace(std::initializer_list<U> il, Args&&... args)
+  {
+    return do_emplace<I>(typename traits<I>::is_boxed{}, il, std::forward<Args>(args)...);
+  }
+
+  template<
+      class T, class... Args,
+      typename std::enable_if<polyfill::detail::exactly_once<T, typename detail::box_traits<Ts>::value_type...>::value, std::nullptr_t>::type = nullptr,
+      std::size_t I = polyfill::detail::find_index<T, typename detail::box_traits<Ts>::value_type...>::value,
+      typename std::enable_if<std::is_constructible<T, Args...>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX20_CONSTEXPR T& emplace(Args&&... args)
+  {
+    return do_emplace<I>(typename traits<I>::is_boxed{}, std::forward<Args>(args)...);
+  }
+
+  template<
+      class T, class U, class... Args,
+      typename std::enable_if<polyfill::detail::exactly_once<T, typename detail::box_traits<Ts>::value_type...>::value, std::nullptr_t>::type = nullptr,
+      std::size_t I = polyfill::detail::find_index<T, typename detail::box_traits<Ts>::value_type...>::value,
+      typename std::enable_if<std::is_constructible<T, std::initializer_list<U>&, Args...>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX20_CONSTEXPR T& emplace(std::initializer_list<U> il, Args&&... args)
+  {
+    return do_emplace<I>(typename traits<I>::is_boxed{}, il, std::forward<Args>(args)...);
+  }
+
+  constexpr std::size_t index() const noexcept { return v_.index(); }
+
+  constexpr bool valueless_by_exception() const noexcept { return v_.valueless_by_exception(); }
+
+  // The underlying variant, with boxed alternatives exposed as indirect<T, A>.
+  YK_POLYFILL_CXX14_CONSTEXPR variant_type& base() & noexcept { return v_; }
+  constexpr variant_type const& base() const& noexcept { return v_; }
+  YK_POLYFILL_CXX14_CONSTEXPR variant_type&& base() && noexcept { return std::move(v_); }
+  constexpr variant_type const&& base() const&& noexcept { return std::move(v_); }
+
+  // Swapping boxed alternatives exchanges pointers; nothing is reallocated.
+  YK_POLYFILL_CXX20_CONSTEXPR void swap(boxed_variant& other) noexcept(noexcept(std::declval<variant_type&>().swap(std::declval<variant_type&>())))
+  {
+    v_.swap(other.v_);
+  }
+};
+
+namespace detail {
+
+template<class T>
+struct is_boxed_variant : false_type {};
+
+template<class... Ts>
+struct is_boxed_variant<boxed_variant<Ts...>> : true_type {};
+
+template<std::size_t I, class... Ts>
+using boxed_value_t = typename box_traits<typename pack_indexing<I, Ts...>::type>::value_type;
+
+}  // namespace detail
+
+// get<I>
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR detail::boxed_value_t<I, Ts...>& get(boxed_variant<Ts...>& v)
+{
+  return detail::unbox(polyfill::get<I>(detail::boxed_variant_access::base(v)));
+}
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR detail::boxed_value_t<I, Ts...> const& get(boxed_variant<Ts...> const& v)
+{
+  return detail::unbox(polyfill::get<I>(detail::boxed_variant_access::base(v)));
+}
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR detail::boxed_value_t<I, Ts...>&& get(boxed_variant<Ts...>&& v)
+{
+  return detail::unbox(polyfill::get<I>(detail::boxed_variant_access::base(std::move(v))));
+}
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR detail::boxed_value_t<I, Ts...> const&& get(boxed_variant<Ts...> const&& v)
+{
+  return detail::unbox(polyfill::get<I>(detail::boxed_variant_access::base(std::move(v))));
+}
+
+// get<T>
+
+template<class T, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR T& get(boxed_variant<Ts...>& v)
+{
+  static_assert(polyfill::detail::exactly_once<T, typename detail::box_traits<Ts>::value_type...>::value, "T must occur exactly once in Ts...");
+  return extension::get<polyfill::detail::find_index<T, typename detail::box_traits<Ts>::value_type...>::value>(v);
+}
+
+template<class T, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR T const& get(boxed_variant<Ts...> const& v)
+{
+  static_assert(polyfill::detail::exactly_once<T, typename detail::box_traits<Ts>::value_type...>::value, "T must occur exactly once in Ts...");
+  return extension::get<polyfill::detail::find_index<T, typename detail::box_traits<Ts>::value_type...>::value>(v);
+}
+
+template<class T, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR T&& get(boxed_variant<Ts...>&& v)
+{
+  static_assert(polyfill::detail::exactly_once<T, typename detail::box_traits<Ts>::value_type...>::value, "T must occur exactly once in Ts...");
+  return extension::get<polyfill::detail::find_index<T, typename detail::box_traits<Ts>::value_type...>::value>(std::move(v));
+}
+
+template<class T, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR T const&& get(boxed_variant<Ts...> const&& v)
+{
+  static_assert(polyfill::detail::exactly_once<T, typename detail::box_traits<Ts>::value_type...>::value, "T must occur exactly once in Ts...");
+  return extension::get<polyfill::detail::find_index<T, typename detail::box_traits<Ts>::value_type...>::value>(std::move(v));
+}
+
+// get_if
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename std::add_pointer<detail::boxed_value_t<I, Ts...>>::type get_if(boxed_variant<Ts...>* v) noexcept
+{
+  return v && v->index() == I ? std::addressof(extension::get<I>(*v)) : nullptr;
+}
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename std::add_pointer<detail::boxed_value_t<I, Ts...> const>::type get_if(boxed_variant<Ts...> const* v) noexcept
+{
+  return v && v->index() == I ? std::addressof(extension::get<I>(*v)) : nullptr;
+}
+
+template<class T, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename std::add_pointer<T>::type get_if(boxed_variant<Ts...>* v) noexcept
+{
+  static_assert(polyfill::detail::exactly_once<T, typename detail::box_traits<Ts>::value_type...>::value, "T must occur exactly once in Ts...");
+  return extension::get_if<polyfill::detail::find_index<T, typename detail::box_traits<Ts>::value_type...>::value>(v);
+}
+
+template<class T, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename std::add_pointer<T const>::type get_if(boxed_variant<Ts...> const* v) noexcept
+{
+  static_assert(polyfill::detail::exactly_once<T, typename detail::box_traits<Ts>::value_type...>::value, "T must occur exactly once in Ts...");
+  return extension::get_if<polyfill::detail::find_index<T, typename detail::box_traits<Ts>::value_type...>::value>(v);
+}
+
+template<class T, class... Ts>
+constexpr bool holds_alternative(boxed_variant<Ts...> const& v) noexcept
+{
+  static_assert(polyfill::detail::exactly_once<T, typename detail::box_traits<Ts>::value_type...>::value, "T must occur exactly once in Ts...");
+  return v.index() == polyfill::detail::find_index<T, typename detail::box_traits<Ts>::value_type...>::value;
+}
+
+// visit: forwards to polyfill::visit on the underlying variants, unboxing each argument before calling `vis`
+
+template<
+    class Visitor, class... Variants,
+    typename std::enable_if<conjunction<detail::is_boxed_variant<typename remove_cvref<Variants>::type>...>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_CXX14_CONSTEXPR auto visit(Visitor&& vis, Variants&&... vars)
+    -> decltype(polyfill::visit(detail::unboxing_visitor<Visitor>{std::forward<Visitor>(vis)}, detail::boxed_variant_access::base(std::forward<Variants>(vars))...))
+{
+  return polyfill::visit(detail::unboxing_visitor<Visitor>{std::forward<Visitor>(vis)}, detail::boxed_variant_access::base(std::forward<Variants>(vars))...);
+}
+
+template<class... Ts>
+YK_POLYFILL_CXX20_CONSTEXPR void swap(boxed_variant<Ts...>& lhs, boxed_variant<Ts...>& rhs) noexcept(noexcept(lhs.swap(rhs)))
+{
+  lhs.swap(rhs);
+}
+
+template<class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR bool operator==(boxed_variant<Ts...> const& lhs, boxed_variant<Ts...> const& rhs)
+{
+  return lhs.base() == rhs.base();
+}
+
+template<class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR bool operator!=(boxed_variant<Ts...> const& lhs, boxed_variant<Ts...> const& rhs)
+{
+  return lhs.base() != rhs.base();
+}
+
+}  // namespace extension
+
+template<class... Ts>
+struct variant_size<extension::boxed_variant<Ts...>> : integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template<std::size_t I, class... Ts>
+struct variant_alternative<I, extension::boxed_variant<Ts...>> {
+  using type = extension::detail::boxed_value_t<I, Ts...>;
+};
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+#endif  // YK_ZZ_POLYFILL_EXTENSION_BOXED_VARIANT_HPP
@@ -0,0 +1,205 @@
+#ifndef YK_ZZ_POLYFILL_EXTENSION_BYTE_ORDER_HPP
+#define YK_ZZ_POLYFILL_EXTENSION_BYTE_ORDER_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <yk/polyfill/bits/core_traits.hpp>
+
+#include <yk/polyfill/bit.hpp>
+
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if __cpp_lib_span >= 202002L
+#include <span>
+#endif
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+// Endian-aware loads and stores of arithmetic and enumeration values at arbitrary (unaligned) byte addresses,
+// for decoding wire formats in place:
+//
+//   std::uint32_t len = load_be<std::uint32_t>(p);
+//   double x = load_le<double>(p + 4);
+//
+// Each access is one unaligned memcpy of sizeof(T) bytes plus a byteswap when the order differs from the native one;
+// compilers turn that into a single load/store and a bswap (movbe where available).
+// The _n and span forms convert whole arrays: a plain memcpy when no swap is needed, otherwise a loop that vectorizes.
+
+namespace detail {
+
+static_assert(endian::native == endian::little || endian::native == endian::big, "mixed-endian platforms are not supported");
+
+template<std::size_t Size>
+struct byte_order_uint {};
+
+template<>
+struct byte_order_uint<1> {
+  using type = std::uint8_t;
+};
+
+template<>
+struct byte_order_uint<2> {
+  using type = std::uint16_t;
+};
+
+template<>
+struct byte_order_uint<4> {
+  using type = std::uint32_t;
+};
+
+template<>
+struct byte_order_uint<8> {
+  using type = std::uint64_t;
+};
+
+template<class T>
+struct is_byte_order_value
+    : bool_constant<
+          (std::is_integral<T>::value || std::is_enum<T>::value || std::is_floating_point<T>::value) && !std::is_same<T, bool>::value
+          && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)> {};
+
+template<class T>
+using enable_if_byte_order_value = typename std::enable_if<is_byte_order_value<T>::value, std::nullptr_t>::type;
+
+template<endian Order, class T>
+inline T load(unsigned char const* src) noexcept
+{
+  using U = typename byte_order_uint<sizeof(T)>::type;
+  U u;
+  std::memcpy(&u, src, sizeof(U));
+  if (Order != endian::native) u = polyfill::byteswap(u);
+  return polyfill::bit_cast<T>(u);
+}
+
+template<endian Order, class T>
+inline void store(unsigned char* dst, T value) noexcept
+{
+  using U = typename byte_order_uint<sizeof(T)>::type;
+  U u = polyfill::bit_cast<U>(value);
+  if (Order != endian::native) u = polyfill::byteswap(u);
+  std::memcpy(dst, &u, sizeof(U));
+}
+
+template<endian Order, class T>
+inline unsigned char const* load_n(unsigned char const* src, std::size_t n, T* dst) noexcept
+{
+  if (Order == endian::native || sizeof(T) == 1) {
+    if (n != 0) std::memcpy(dst, src, n * sizeof(T));
+  } else {
+    for (std::size_t i = 0; i != n; ++i) dst[i] = detail::load<Order, T>(src + i * sizeof(T));
+  }
+  return src + n * sizeof(T);
+}
+
+template<endian Order, class T>
+inline unsigned char* store_n(T const* src, std::size_t n, unsigned char* dst) noexcept
+{
+  if (Order == endian::native || sizeof(T) == 1) {
+    if (n != 0) std::memcpy(dst, src, n * sizeof(T));
+  } else {
+    for (std::size_t i = 0; i != n; ++i) detail::store<Order>(dst + i * sizeof(T), src[i]);
+  }
+  return dst + n * sizeof(T);
+}
+
+}  // namespace detail
+
+// single values
+
+template<class T, detail::enable_if_byte_order_value<T> = nullptr>
+inline T load_le(unsigned char const* src) noexcept
+{
+  return detail::load<endian::little, T>(src);
+}
+
+template<class T, detail::enable_if_byte_order_value<T> = nullptr>
+inline T load_be(unsigned char const* src) noexcept
+{
+  return detail::load<endian::big, T>(src);
+}
+
+template<class T, detail::enable_if_byte_order_value<T> = nullptr>
+inline void store_le(unsigned char* dst, T value) noexcept
+{
+  detail::store<endian::little>(dst, value);
+}
+
+template<class T, detail::enable_if_byte_order_value<T> = nullptr>
+inline void store_be(unsigned char* dst, T value) noexcept
+{
+  detail::store<endian::big>(dst, value);
+}
+
+// arrays: n values from/to n * sizeof(T) bytes; return the byte pointer past the converted range
+
+template<class T, detail::enable_if_byte_order_value<T> = nullptr>
+inline unsigned char const* load_le_n(unsigned char const* src, std::size_t n, T* dst) noexcept
+{
+  return detail::load_n<endian::little>(src, n, dst);
+}
+
+template<class T, detail::enable_if_byte_order_value<T> = nullptr>
+inline unsigned char const* load_be_n(unsigned char const* src, std::size_t n, T* dst) noexcept
+{
+  return detail::load_n<endian::big>(src, n, dst);
+}
+
+template<class T, detail::enable_if_byte_order_value<T> = nullptr>
+inline unsigned char* store_le_n(T const* src, std::size_t n, unsigned char* dst) noexcept
+{
+  return detail::store_n<endian::little>(src, n, dst);
+}
+
+template<class T, detail::enable_if_byte_order_value<T> = nullptr>
+inline unsigned char* store_be_n(T const* src, std::size_t n, unsigned char* dst) noexcept
+{
+  return detail::store_n<endian::big>(src, n, dst);
+}
+
+#if __cpp_lib_span >= 202002L
+
+// fills all of `dst`; precondition: src.size() >= dst.size() * sizeof(T). Returns the unconsumed bytes.
+
+template<class T, std::size_t Extent, detail::enable_if_byte_order_value<T> = nullptr>
+inline std::span<unsigned char const> load_le(std::span<unsigned char const> src, std::span<T, Extent> dst) noexcept
+{
+  return src.subspan(extension::load_le_n(src.data(), dst.size(), dst.data()) - src.data());
+}
+
+template<class T, std::size_t Extent, detail::enable_if_byte_order_value<T> = nullptr>
+inline std::span<unsigned char const> load_be(std::span<unsigned char const> src, std::span<T, Extent> dst) noexcept
+{
+  return src.subspan(extension::load_be_n(src.data(), dst.size(), dst.data()) - src.data());
+}
+
+// writes all of `src`; precondition: dst.size() >= src.size() * sizeof(T). Returns the unwritten bytes.
+
+template<class T, std::size_t Extent, detail::enable_if_byte_order_value<typename std::remove_const<T>::type> = nullptr>
+inline std::span<unsigned char> store_le(std::span<T, Extent> src, std::span<unsigned char> dst) noexcept
+{
+  return dst.subspan(extension::store_le_n(src.data(), src.size(), dst.data()) - dst.data());
+}
+
+template<class T, std::size_t Extent, detail::enable_if_byte_order_value<typename std::remove_const<T>::type> = nullptr>
+inline std::span<unsigned char> store_be(std::span<T, Extent> src, std::span<unsigned char> dst) noexcept
+{
+  return dst.subspan(extension::store_be_n(src.data(), src.size(), dst.data()) - dst.data());
+}
+
+#endif
+
+}  // namespace extension
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+#endif  // YK_ZZ_POLYFILL_EXTENSION_BYTE_ORDER_HPP
@@ -0,0 +1,136 @@
+#ifndef YK_ZZ_POLYFILL_EXTENSION_DISPATCH_INDEX_HPP
+#define YK_ZZ_POLYFILL_EXTENSION_DISPATCH_INDEX_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <yk/polyfill/bits/core_traits.hpp>
+
+#include <yk/polyfill/extension/pack_indexing.hpp>
+
+#include <yk/polyfill/functional.hpp>
+#include <yk/polyfill/utility.hpp>
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+// dispatch_index<N>(i, f): calls f(integral_constant<std::size_t, I>{}) for I == i, turning a runtime index in [0, N)
+// into a compile-time one. dispatch_index<N0, N1, ...>(i0, i1, ..., f) does the same for several indices at once and
+// calls f with one integral_constant per index.
+//
+// Same scheme as the multi-variant visit table: the indices are folded into one row-major flat index, which selects an
+// entry of a table of N0 * N1 * ... function pointers, so the whole dispatch is a single indirect call.
+// Out-of-range indices throw std::out_of_range. Every result is converted to the result type of f(0, 0, ...).
+//
+//   dispatch_index<4>(log2_width, [&](auto w) { return simd_kernel<(1 << decltype(w)::value)>(data); });
+
+namespace detail {
+
+template<std::size_t... Ns>
+struct dispatch_extent_product : integral_constant<std::size_t, 1> {};
+
+template<std::size_t N0, std::size_t... Ns>
+struct dispatch_extent_product<N0, Ns...> : integral_constant<std::size_t, N0 * dispatch_extent_product<Ns...>::value> {};
+
+// stride of the K-th index in the row-major flat index: the product of the extents after it
+template<std::size_t K, std::size_t... Ns>
+struct dispatch_stride;
+
+template<std::size_t K, std::size_t N0, std::size_t... Ns>
+struct dispatch_stride<K, N0, Ns...> : dispatch_stride<K - 1, Ns...> {};
+
+template<std::size_t N0, std::size_t... Ns>
+struct dispatch_stride<0, N0, Ns...> : dispatch_extent_product<Ns...> {};
+
+// K-th index encoded in FlatI
+template<std::size_t FlatI, std::size_t K, std::size_t... Ns>
+struct dispatch_index_at
+    : integral_constant<std::size_t, FlatI / dispatch_stride<K, Ns...>::value % pack_indexing<K, integral_constant<std::size_t, Ns>...>::type::value> {};
+
+template<class R, std::size_t FlatI, class KSeq, class NSeq>
+struct do_dispatch_index;
+
+template<class R, std::size_t FlatI, std::size_t... Ks, std::size_t... Ns>
+struct do_dispatch_index<R, FlatI, index_sequence<Ks...>, index_sequence<Ns...>> {
+  template<class F>
+  static YK_POLYFILL_CXX14_CONSTEXPR R call(F&& f)
+  {
+    return polyfill::invoke_r<R>(std::forward<F>(f), integral_constant<std::size_t, dispatch_index_at<FlatI, Ks, Ns...>::value>{}...);
+  }
+};
+
+template<class R, class F, class FlatSeq, std::size_t... Ns>
+struct dispatch_index_table;
+
+template<class R, class F, std::size_t... FlatIs, std::size_t... Ns>
+struct dispatch_index_table<R, F, index_sequence<FlatIs...>, Ns...> {
+  static constexpr R (*value[sizeof...(FlatIs)])(F&&){
+      &do_dispatch_index<R, FlatIs, make_index_sequence<sizeof...(Ns)>, index_sequence<Ns...>>::template call<F>...
+  };
+};
+
+template<class R, class F, std::size_t... FlatIs, std::size_t... Ns>
+constexpr R (*dispatch_index_table<R, F, index_sequence<FlatIs...>, Ns...>::value[sizeof...(FlatIs)])(F&&);
+
+// folds the leading runtime indices into a flat index, then calls through the table with the trailing function
+template<class R, class Table, std::size_t... Ns>
+struct dispatch_index_fold;
+
+template<class R, class Table>
+struct dispatch_index_fold<R, Table> {
+  template<class F>
+  YK_POLYFILL_ALWAYS_INLINE static YK_POLYFILL_CXX14_CONSTEXPR R apply(std::size_t flat_i, F&& f)
+  {
+    return Table::value[flat_i](std::forward<F>(f));
+  }
+};
+
+template<class R, class Table, std::size_t N0, std::size_t... Ns>
+struct dispatch_index_fold<R, Table, N0, Ns...> {
+  template<class... Rest>
+  YK_POLYFILL_ALWAYS_INLINE static YK_POLYFILL_CXX14_CONSTEXPR R apply(std::size_t flat_i, std::size_t i0, Rest&&... rest)
+  {
+    if (YK_POLYFILL_UNLIKELY(i0 >= N0)) throw std::out_of_range("dispatch_index: index out of range");
+    return dispatch_index_fold<R, Table, Ns...>::apply(flat_i * N0 + i0, std::forward<Rest>(rest)...);
+  }
+};
+
+template<class F, class Indices>
+struct dispatch_index_result_impl;
+
+template<class F, std::size_t... Ks>
+struct dispatch_index_result_impl<F, index_sequence<Ks...>> : invoke_result<F, integral_constant<std::size_t, Ks * 0>...> {};
+
+// result of f(integral_constant<std::size_t, 0>{}, ...) with one argument per index
+template<class F, std::size_t Rank>
+struct dispatch_index_result : dispatch_index_result_impl<F, make_index_sequence<Rank>> {};
+
+}  // namespace detail
+
+// Args are the runtime indices (convertible to std::size_t) followed by the function
+template<
+    std::size_t... Ns, class... Args, typename std::enable_if<sizeof...(Args) == sizeof...(Ns) + 1, std::nullptr_t>::type = nullptr,
+    class F = typename pack_indexing<sizeof...(Ns), Args...>::type, class R = typename detail::dispatch_index_result<F, sizeof...(Ns)>::type>
+YK_POLYFILL_CXX14_CONSTEXPR R dispatch_index(Args&&... args)
+{
+  static_assert(sizeof...(Ns) > 0, "dispatch_index needs at least one extent");
+  static_assert(conjunction<bool_constant<(Ns > 0)>...>::value, "dispatch_index extents must be positive");
+  using table = detail::dispatch_index_table<R, F, make_index_sequence<detail::dispatch_extent_product<Ns...>::value>, Ns...>;
+  return detail::dispatch_index_fold<R, table, Ns...>::apply(0, std::forward<Args>(args)...);
+}
+
+}  // namespace extension
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+#endif  // YK_ZZ_POLYFILL_EXTENSION_DISPATCH_INDEX_HPP
@@ -38,8 +38,8 @@ struct ebo_storage<T, /*IsEmptyBase = */ false> {
   {
   }
 
-  YK_POLYFILL_CXX14_CONSTEXPR T& stored_value() noexcept { return value_; }
-  constexpr T const& stored_value() const noexcept { return value_; }
+  YK_POLYFILL_ALWAYS_INLINE YK_POLYFILL_CXX14_CONSTEXPR T& stored_value() noexcept { return value_; }
+  YK_POLYFILL_ALWAYS_INLINE constexpr T const& stored_value() const noexcept { return value_; }
 };
 
 template<class T>
@@ -53,8 +53,8 @@ struct ebo_storage<T, /*IsEmptyBase = */ true> : private T {
   {
   }
 
-  YK_POLYFILL_CXX14_CONSTEXPR T& stored_value() noexcept { return static_cast<T&>(*this); }
-  constexpr T const& stored_value() const noexcept { return static_cast<T const&>(*this); }
+  YK_POLYFILL_ALWAYS_INLINE YK_POLYFILL_CXX14_CONSTEXPR T& stored_value() noexcept { return static_cast<T&>(*this); }
+  YK_POLYFILL_ALWAYS_INLINE constexpr T const& stored_value() const noexcept { return static_cast<T const&>(*this); }
 };
 
 }  // namespace extension
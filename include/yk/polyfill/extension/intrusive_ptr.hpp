@@ -0,0 +1,285 @@
+#ifndef YK_ZZ_POLYFILL_EXTENSION_INTRUSIVE_PTR_HPP
+#define YK_ZZ_POLYFILL_EXTENSION_INTRUSIVE_PTR_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <yk/polyfill/bits/core_traits.hpp>
+
+#include <yk/polyfill/utility.hpp>
+
+#include <atomic>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+// Counter policies for intrusive_ref_counter.
+// thread_safe_counter: relaxed increments; release decrements, with an acquire fence only after the final one, so the
+// deleting thread sees every other owner's writes (the boost::intrusive_ref_counter scheme).
+// thread_unsafe_counter: plain integer, for objects that never cross threads.
+
+struct thread_safe_counter {
+  using type = std::atomic<std::size_t>;
+
+  static std::size_t load(type const& c) noexcept { return c.load(std::memory_order_relaxed); }
+  static void increment(type& c) noexcept { c.fetch_add(1, std::memory_order_relaxed); }
+  static bool decrement(type& c) noexcept
+  {
+    if (c.fetch_sub(1, std::memory_order_release) != 1) return false;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return true;
+  }
+};
+
+struct thread_unsafe_counter {
+  using type = std::size_t;
+
+  static constexpr std::size_t load(type const& c) noexcept { return c; }
+  static YK_POLYFILL_CXX14_CONSTEXPR void increment(type& c) noexcept { ++c; }
+  static YK_POLYFILL_CXX14_CONSTEXPR bool decrement(type& c) noexcept { return --c == 0; }
+};
+
+// intrusive_ref_counter<Derived, CounterPolicy>: CRTP base embedding the reference count in the object.
+// Copying a Derived does not copy its count; the last release deletes it as `Derived`.
+
+template<class Derived, class CounterPolicy = thread_safe_counter>
+class intrusive_ref_counter {
+public:
+  using counter_policy = CounterPolicy;
+
+  std::size_t use_count() const noexcept { return CounterPolicy::load(count_); }
+
+  friend void intrusive_ptr_add_ref(intrusive_ref_counter const* p) noexcept { CounterPolicy::increment(p->count_); }
+
+  friend void intrusive_ptr_release(intrusive_ref_counter const* p) noexcept
+  {
+    if (CounterPolicy::decrement(p->count_)) {
+      delete static_cast<Derived const*>(p);
+    }
+  }
+
+protected:
+  constexpr intrusive_ref_counter() noexcept : count_(0) {}
+  constexpr intrusive_ref_counter(intrusive_ref_counter const&) noexcept : count_(0) {}
+  YK_POLYFILL_CXX14_CONSTEXPR intrusive_ref_counter& operator=(intrusive_ref_counter const&) noexcept { return *this; }
+  ~intrusive_ref_counter() = default;
+
+private:
+  mutable typename CounterPolicy::type count_;
+};
+
+// intrusive_default_policy: finds `intrusive_ptr_add_ref` / `intrusive_ptr_release` by ADL, so any type providing
+// them (not only intrusive_ref_counter derivatives) works. A custom Policy supplies static add_ref(T*) / release(T*).
+
+struct intrusive_default_policy {
+  template<class T>
+  static void add_ref(T* p) noexcept
+  {
+    intrusive_ptr_add_ref(p);
+  }
+
+  template<class T>
+  static void release(T* p) noexcept
+  {
+    intrusive_ptr_release(p);
+  }
+};
+
+template<class T, class Policy = intrusive_default_policy>
+class intrusive_ptr {
+public:
+  using element_type = T;
+  using pointer = T*;
+  using policy_type = Policy;
+
+  constexpr intrusive_ptr() noexcept : ptr_(nullptr) {}
+
+  constexpr intrusive_ptr(std::nullptr_t) noexcept : ptr_(nullptr) {}
+
+  // add_ref = false adopts a reference the caller already holds (see detach()).
+  intrusive_ptr(T* p, bool add_ref = true) noexcept : ptr_(p)
+  {
+    if (ptr_ && add_ref) Policy::add_ref(ptr_);
+  }
+
+  intrusive_ptr(intrusive_ptr const& other) noexcept : ptr_(other.ptr_)
+  {
+    if (ptr_) Policy::add_ref(ptr_);
+  }
+
+  template<class U, typename std::enable_if<std::is_convertible<U*, T*>::value, std::nullptr_t>::type = nullptr>
+  intrusive_ptr(intrusive_ptr<U, Policy> const& other) noexcept : ptr_(other.get())
+  {
+    if (ptr_) Policy::add_ref(ptr_);
+  }
+
+  YK_POLYFILL_CXX14_CONSTEXPR intrusive_ptr(intrusive_ptr&& other) noexcept : ptr_(polyfill::exchange(other.ptr_, nullptr)) {}
+
+  template<class U, typename std::enable_if<std::is_convertible<U*, T*>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX14_CONSTEXPR intrusive_ptr(intrusive_ptr<U, Policy>&& other) noexcept : ptr_(other.detach())
+  {
+  }
+
+  ~intrusive_ptr() noexcept
+  {
+    if (ptr_) Policy::release(ptr_);
+  }
+
+  intrusive_ptr& operator=(intrusive_ptr const& other) noexcept
+  {
+    intrusive_ptr(other).swap(*this);
+    return *this;
+  }
+
+  template<class U, typename std::enable_if<std::is_convertible<U*, T*>::value, std::nullptr_t>::type = nullptr>
+  intrusive_ptr& operator=(intrusive_ptr<U, Policy> const& other) noexcept
+  {
+    intrusive_ptr(other).swap(*this);
+    return *this;
+  }
+
+  intrusive_ptr& operator=(intrusive_ptr&& other) noexcept
+  {
+    intrusive_ptr(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  template<class U, typename std::enable_if<std::is_convertible<U*, T*>::value, std::nullptr_t>::type = nullptr>
+  intrusive_ptr& operator=(intrusive_ptr<U, Policy>&& other) noexcept
+  {
+    intrusive_ptr(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  intrusive_ptr& operator=(T* p) noexcept
+  {
+    intrusive_ptr(p).swap(*this);
+    return *this;
+  }
+
+  intrusive_ptr& operator=(std::nullptr_t) noexcept
+  {
+    reset();
+    return *this;
+  }
+
+  // Observers
+
+  constexpr T* get() const noexcept { return ptr_; }
+
+  constexpr T& operator*() const noexcept { return *ptr_; }
+
+  constexpr T* operator->() const noexcept { return ptr_; }
+
+  constexpr explicit operator bool() const noexcept { return ptr_ != nullptr; }
+
+  // Modifiers
+
+  void reset() noexcept { intrusive_ptr().swap(*this); }
+
+  void reset(T* p, bool add_ref = true) noexcept { intrusive_ptr(p, add_ref).swap(*this); }
+
+  // Gives up ownership without releasing; the caller now holds the reference.
+  YK_POLYFILL_CXX14_CONSTEXPR T* detach() noexcept { return polyfill::exchange(ptr_, nullptr); }
+
+  YK_POLYFILL_CXX14_CONSTEXPR void swap(intrusive_ptr& other) noexcept
+  {
+    T* tmp = ptr_;
+    ptr_ = other.ptr_;
+    other.ptr_ = tmp;
+  }
+
+private:
+  T* ptr_;
+};
+
+template<class T, class P>
+YK_POLYFILL_CXX14_CONSTEXPR void swap(intrusive_ptr<T, P>& x, intrusive_ptr<T, P>& y) noexcept
+{
+  x.swap(y);
+}
+
+template<class T, class U, class P>
+constexpr bool operator==(intrusive_ptr<T, P> const& x, intrusive_ptr<U, P> const& y) noexcept
+{
+  return x.get() == y.get();
+}
+
+template<class T, class U, class P>
+constexpr bool operator!=(intrusive_ptr<T, P> const& x, intrusive_ptr<U, P> const& y) noexcept
+{
+  return x.get() != y.get();
+}
+
+template<class T, class U, class P>
+YK_POLYFILL_CXX14_CONSTEXPR bool operator<(intrusive_ptr<T, P> const& x, intrusive_ptr<U, P> const& y) noexcept
+{
+  using CT = typename std::common_type<T*, U*>::type;
+  return std::less<CT>{}(x.get(), y.get());
+}
+
+template<class T, class P>
+constexpr bool operator==(intrusive_ptr<T, P> const& x, std::nullptr_t) noexcept
+{
+  return !x;
+}
+
+template<class T, class P>
+constexpr bool operator==(std::nullptr_t, intrusive_ptr<T, P> const& x) noexcept
+{
+  return !x;
+}
+
+template<class T, class P>
+constexpr bool operator!=(intrusive_ptr<T, P> const& x, std::nullptr_t) noexcept
+{
+  return static_cast<bool>(x);
+}
+
+template<class T, class P>
+constexpr bool operator!=(std::nullptr_t, intrusive_ptr<T, P> const& x) noexcept
+{
+  return static_cast<bool>(x);
+}
+
+// make_intrusive<T>(args...): the new object starts with a count of one held by the returned pointer.
+template<class T, class Policy = intrusive_default_policy, class... Args>
+YK_POLYFILL_NODISCARD intrusive_ptr<T, Policy> make_intrusive(Args&&... args)
+{
+  return intrusive_ptr<T, Policy>(new T(std::forward<Args>(args)...));
+}
+
+namespace detail {
+
+template<class T, class P, class = void>
+struct intrusive_ptr_hash {};
+
+template<class T, class P>
+struct intrusive_ptr_hash<T, P, void_t<decltype(std::hash<T*>{}(std::declval<T* const&>()))>> {
+  std::size_t operator()(intrusive_ptr<T, P> const& p) const noexcept(noexcept(std::hash<T*>{}(p.get()))) { return std::hash<T*>{}(p.get()); }
+};
+
+}  // namespace detail
+
+}  // namespace extension
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+// Hash specialization
+namespace std {
+
+template<class T, class P>
+struct hash<yk::polyfill::extension::intrusive_ptr<T, P>> : yk::polyfill::extension::detail::intrusive_ptr_hash<T, P> {};
+
+}  // namespace std
+
+#endif  // YK_ZZ_POLYFILL_EXTENSION_INTRUSIVE_PTR_HPP
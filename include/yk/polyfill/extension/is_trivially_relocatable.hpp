@@ -0,0 +1,40 @@
+#ifndef YK_ZZ_POLYFILL_EXTENSION_IS_TRIVIALLY_RELOCATABLE_HPP
+#define YK_ZZ_POLYFILL_EXTENSION_IS_TRIVIALLY_RELOCATABLE_HPP
+
+#include <yk/polyfill/bits/core_traits.hpp>
+
+#include <memory>
+#include <type_traits>
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+// is_trivially_relocatable<T>: moving a T to a new address and ending the old object's lifetime is equivalent to
+// copying its bytes and forgetting the source (no destructor call). True for trivially copyable types; specialize it
+// for owning handles such as pointer + allocator pairs. Do not specialize it for types that store pointers into
+// themselves (e.g. SSO strings on libstdc++, node-based containers with an embedded sentinel).
+
+template<class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template<class T>
+struct is_trivially_relocatable<T const> : is_trivially_relocatable<T> {};
+
+// stateless, but its user-provided copy constructor hides that from is_trivially_copyable
+template<class T>
+struct is_trivially_relocatable<std::allocator<T>> : true_type {};
+
+template<class T, class D>
+struct is_trivially_relocatable<std::unique_ptr<T, D>>
+    : conjunction<is_trivially_relocatable<typename std::unique_ptr<T, D>::pointer>, is_trivially_relocatable<D>> {};
+
+}  // namespace extension
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+#endif  // YK_ZZ_POLYFILL_EXTENSION_IS_TRIVIALLY_RELOCATABLE_HPP
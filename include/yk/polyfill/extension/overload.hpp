@@ -0,0 +1,57 @@
+#ifndef YK_ZZ_POLYFILL_EXTENSION_OVERLOAD_HPP
+#define YK_ZZ_POLYFILL_EXTENSION_OVERLOAD_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+// overload<Fs...>: one function object whose operator() set is the union of those of Fs... (class types only).
+// Built by linear inheritance so it also works without C++17 pack expansion in using-declarations;
+// empty lambdas cost nothing thanks to EBO.
+//
+//   auto vis = extension::make_overload([](int) { ... }, [](std::string const&) { ... });
+//   polyfill::visit<void>(vis, v);
+
+template<class... Fs>
+struct overload;
+
+template<class F>
+struct overload<F> : F {
+  constexpr explicit overload(F f) : F(std::move(f)) {}
+
+  using F::operator();
+};
+
+template<class F, class... Fs>
+struct overload<F, Fs...> : F, overload<Fs...> {
+  constexpr explicit overload(F f, Fs... fs) : F(std::move(f)), overload<Fs...>(std::move(fs)...) {}
+
+  using F::operator();
+  using overload<Fs...>::operator();
+};
+
+#if __cpp_deduction_guides >= 201703L
+template<class... Fs>
+overload(Fs...) -> overload<Fs...>;
+#endif
+
+template<class... Fs>
+constexpr overload<typename std::decay<Fs>::type...> make_overload(Fs&&... fs)
+{
+  return overload<typename std::decay<Fs>::type...>(std::forward<Fs>(fs)...);
+}
+
+}  // namespace extension
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+#endif  // YK_ZZ_POLYFILL_EXTENSION_OVERLOAD_HPP
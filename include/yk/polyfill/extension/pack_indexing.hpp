@@ -1,10 +1,23 @@
 #ifndef YK_ZZ_POLYFILL_EXTENSION_PACK_INDEXING_HPP
 #define YK_ZZ_POLYFILL_EXTENSION_PACK_INDEXING_HPP
 
+#include <yk/polyfill/config.hpp>
+
 #include <yk/polyfill/utility.hpp>
 
 #include <cstddef>
 
+// Selects the I-th type in constant depth when the compiler can: C++26 pack indexing (`Ts...[I]`), then the
+// `__type_pack_element` builtin (Clang, GCC 14+). The overload-resolution trick below is the portable fallback;
+// it needs a fresh make_index_sequence<I> per index.
+#if __cpp_pack_indexing >= 202311L
+#define YK_POLYFILL_DETAIL_PACK_INDEXING_SYNTAX 1
+#elif defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define YK_POLYFILL_DETAIL_PACK_INDEXING_BUILTIN 1
+#endif
+#endif
+
 namespace yk {
 
 namespace polyfill {
@@ -16,8 +29,11 @@ namespace detail {
 template<std::size_t I>
 using make_void = void;
 
+// returned by value so that `select` keeps top-level cv qualifiers, which a prvalue of non-class type would drop
 template<class T>
-struct identity {};
+struct identity {
+  using type = T;
+};
 
 template<class IndexSeq>
 struct do_pack_indexing;
@@ -25,7 +41,7 @@ struct do_pack_indexing;
 template<std::size_t... Is>
 struct do_pack_indexing<index_sequence<Is...>> {
   template<class T>
-  static T select(make_void<Is>*..., identity<T>*, ...);
+  static identity<T> select(make_void<Is>*..., identity<T>*, ...);
 };
 
 }  // namespace detail
@@ -33,9 +49,18 @@ struct do_pack_indexing<index_sequence<Is...>> {
 template<std::size_t I, class... Ts>
 struct pack_indexing {
   static_assert(I < sizeof...(Ts), "index must be less than size of parameter pack");
-  using type = decltype(detail::do_pack_indexing<make_index_sequence<I>>::select(static_cast<detail::identity<Ts>*>(nullptr)...));
+#if defined(YK_POLYFILL_DETAIL_PACK_INDEXING_SYNTAX)
+  using type = Ts...[I];
+#elif defined(YK_POLYFILL_DETAIL_PACK_INDEXING_BUILTIN)
+  using type = __type_pack_element<I, Ts...>;
+#else
+  using type = typename decltype(detail::do_pack_indexing<make_index_sequence<I>>::select(static_cast<detail::identity<Ts>*>(nullptr)...))::type;
+#endif
 };
 
+#undef YK_POLYFILL_DETAIL_PACK_INDEXING_SYNTAX
+#undef YK_POLYFILL_DETAIL_PACK_INDEXING_BUILTIN
+
 }  // namespace extension
 
 }  // namespace polyfill
@@ -0,0 +1,339 @@
+#ifndef YK_ZZ_POLYFILL_EXTENSION_PACKED_TUPLE_HPP
+#define YK_ZZ_POLYFILL_EXTENSION_PACKED_TUPLE_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <yk/polyfill/bits/core_traits.hpp>
+#include <yk/polyfill/bits/swap.hpp>
+#include <yk/polyfill/bits/tuple_leaf.hpp>
+
+#include <yk/polyfill/extension/pack_indexing.hpp>
+
+#include <yk/polyfill/type_traits.hpp>
+#include <yk/polyfill/utility.hpp>
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+// packed_tuple<Ts...>: a tuple whose empty elements come first and take no space (ebo_storage), followed by the others
+// by decreasing alignment (stable for equal alignment), so the only padding is at the end.
+// get<I> and comparisons use the declared order; only the object layout differs.
+// std::tuple_size / std::tuple_element are specialized, so polyfill::apply and structured bindings work as-is.
+//
+//   sizeof(packed_tuple<char, double, char, int>) == 16  // std::tuple<char, double, char, int> is 24 on libstdc++
+
+template<class... Ts>
+class packed_tuple;
+
+namespace detail {
+
+using polyfill::detail::tuple_leaf;
+
+constexpr std::size_t packed_count_true() noexcept { return 0; }
+
+template<class... Bools>
+constexpr std::size_t packed_count_true(bool b, Bools... bs) noexcept
+{
+  return (b ? 1 : 0) + packed_count_true(bs...);
+}
+
+// Layout sort key, larger goes first. Empty leaves lead: placed after a non-empty base, two leaves holding the
+// same empty type cannot both sit at its offset and would grow the object.
+template<class Leaf>
+struct packed_layout_key : integral_constant<std::size_t, std::is_empty<Leaf>::value ? static_cast<std::size_t>(-1) : alignof(Leaf)> {};
+
+// rank of element I in the layout: the number of elements that go before it
+template<std::size_t I, std::size_t KeyI, class Keys, class Is>
+struct packed_rank;
+
+template<std::size_t I, std::size_t KeyI, std::size_t... Keys, std::size_t... Is>
+struct packed_rank<I, KeyI, index_sequence<Keys...>, index_sequence<Is...>>
+    : integral_constant<std::size_t, packed_count_true((Keys > KeyI || (Keys == KeyI && Is < I))...)> {};
+
+constexpr std::size_t packed_index_of_rank(std::size_t, std::size_t i) noexcept { return i; }
+
+template<class... Ranks>
+constexpr std::size_t packed_index_of_rank(std::size_t rank, std::size_t i, std::size_t r, Ranks... rs) noexcept
+{
+  return r == rank ? i : packed_index_of_rank(rank, i + 1, rs...);
+}
+
+template<class Ranks, class Is>
+struct packed_order_impl;
+
+template<std::size_t... Ranks, std::size_t... Is>
+struct packed_order_impl<index_sequence<Ranks...>, index_sequence<Is...>> {
+  using type = index_sequence<packed_index_of_rank(Is, 0, Ranks...)...>;
+};
+
+// the declared indices, listed in layout order
+template<class Is, class... Ts>
+struct packed_order;
+
+template<std::size_t... Is, class... Ts>
+struct packed_order<index_sequence<Is...>, Ts...>
+    : packed_order_impl<
+          index_sequence<packed_rank<
+              Is, packed_layout_key<tuple_leaf<Is, Ts>>::value, index_sequence<packed_layout_key<tuple_leaf<Is, Ts>>::value...>,
+              index_sequence<Is...>>::value...>,
+          index_sequence<Is...>> {};
+
+// constructor arguments in declared order, so that the storage can pick them up in layout order
+template<class Is, class... Us>
+struct packed_args;
+
+template<std::size_t... Is, class... Us>
+struct packed_args<index_sequence<Is...>, Us...> : tuple_leaf<Is, Us&&>... {
+  constexpr explicit packed_args(Us&&... us) : tuple_leaf<Is, Us&&>(std::forward<Us>(us))... {}
+};
+
+template<class Is, class Order, class... Ts>
+struct packed_tuple_storage;
+
+// Bases are declared, and therefore initialized, in layout order; the mem-initializers are written the same way.
+template<std::size_t... Is, std::size_t... Order, class... Ts>
+struct YK_POLYFILL_EMPTY_BASES packed_tuple_storage<index_sequence<Is...>, index_sequence<Order...>, Ts...>
+    : tuple_leaf<Order, typename pack_indexing<Order, Ts...>::type>... {
+  constexpr packed_tuple_storage() : tuple_leaf<Order, typename pack_indexing<Order, Ts...>::type>()... {}
+
+  template<class... Us>
+  constexpr explicit packed_tuple_storage(in_place_t, Us&&... us)
+      : packed_tuple_storage(packed_args<index_sequence<Is...>, Us...>(std::forward<Us>(us)...))
+  {
+  }
+
+private:
+  template<class... Us>
+  constexpr explicit packed_tuple_storage(packed_args<index_sequence<Is...>, Us...> const& args)
+      : tuple_leaf<Order, typename pack_indexing<Order, Ts...>::type>(
+            std::forward<typename pack_indexing<Order, Us...>::type>(polyfill::detail::get_leaf<Order>(args))
+        )...
+  {
+  }
+};
+
+template<class... Ts>
+struct make_packed_tuple_storage {
+  using type = packed_tuple_storage<index_sequence_for<Ts...>, typename packed_order<index_sequence_for<Ts...>, Ts...>::type, Ts...>;
+};
+
+struct packed_tuple_access {
+  template<std::size_t I, class... Ts>
+  static YK_POLYFILL_CXX14_CONSTEXPR typename pack_indexing<I, Ts...>::type& get(packed_tuple<Ts...>& t) noexcept
+  {
+    return polyfill::detail::get_leaf<I>(static_cast<typename packed_tuple<Ts...>::storage_type&>(t));
+  }
+
+  template<std::size_t I, class... Ts>
+  static constexpr typename pack_indexing<I, Ts...>::type const& get(packed_tuple<Ts...> const& t) noexcept
+  {
+    return polyfill::detail::get_leaf<I>(static_cast<typename packed_tuple<Ts...>::storage_type const&>(t));
+  }
+};
+
+template<std::size_t I, std::size_t N>
+struct packed_tuple_compare {
+  template<class... Ts, class... Us>
+  static constexpr bool eq(packed_tuple<Ts...> const& lhs, packed_tuple<Us...> const& rhs)
+  {
+    return packed_tuple_access::get<I>(lhs) == packed_tuple_access::get<I>(rhs) && packed_tuple_compare<I + 1, N>::eq(lhs, rhs);
+  }
+
+  template<class... Ts, class... Us>
+  static constexpr bool lt(packed_tuple<Ts...> const& lhs, packed_tuple<Us...> const& rhs)
+  {
+    return packed_tuple_access::get<I>(lhs) < packed_tuple_access::get<I>(rhs)
+           || (!(packed_tuple_access::get<I>(rhs) < packed_tuple_access::get<I>(lhs)) && packed_tuple_compare<I + 1, N>::lt(lhs, rhs));
+  }
+};
+
+template<std::size_t N>
+struct packed_tuple_compare<N, N> {
+  template<class... Ts, class... Us>
+  static constexpr bool eq(packed_tuple<Ts...> const&, packed_tuple<Us...> const&)
+  {
+    return true;
+  }
+
+  template<class... Ts, class... Us>
+  static constexpr bool lt(packed_tuple<Ts...> const&, packed_tuple<Us...> const&)
+  {
+    return false;
+  }
+};
+
+template<class... Ts>
+struct is_packed_tuple_swappable : conjunction<is_swappable<Ts>...> {};
+
+template<class... Ts>
+struct is_packed_tuple_nothrow_swappable : conjunction<is_nothrow_swappable<Ts>...> {};
+
+}  // namespace detail
+
+template<class... Ts>
+class packed_tuple : private detail::make_packed_tuple_storage<Ts...>::type {
+  using storage_type = typename detail::make_packed_tuple_storage<Ts...>::type;
+
+  friend struct detail::packed_tuple_access;
+
+public:
+  template<
+      class Dummy = void,
+      typename std::enable_if<conjunction<std::is_void<Dummy>, std::is_default_constructible<Ts>...>::value, std::nullptr_t>::type = nullptr>
+  constexpr packed_tuple() noexcept(conjunction<std::is_nothrow_default_constructible<Ts>...>::value) : storage_type()
+  {
+  }
+
+  template<
+      class... Us,
+      typename std::enable_if<
+          sizeof...(Us) == sizeof...(Ts) && sizeof...(Us) != 0
+              && !conjunction<std::is_same<typename remove_cvref<Us>::type, packed_tuple>...>::value,
+          std::nullptr_t>::type = nullptr,
+      typename std::enable_if<conjunction<std::is_constructible<Ts, Us>...>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<conjunction<std::is_convertible<Us, Ts>...>::value, std::nullptr_t>::type = nullptr>
+  constexpr packed_tuple(Us&&... us) noexcept(conjunction<std::is_nothrow_constructible<Ts, Us>...>::value)
+      : storage_type(in_place, std::forward<Us>(us)...)
+  {
+  }
+
+  template<
+      class... Us,
+      typename std::enable_if<
+          sizeof...(Us) == sizeof...(Ts) && sizeof...(Us) != 0
+              && !conjunction<std::is_same<typename remove_cvref<Us>::type, packed_tuple>...>::value,
+          std::nullptr_t>::type = nullptr,
+      typename std::enable_if<conjunction<std::is_constructible<Ts, Us>...>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<!conjunction<std::is_convertible<Us, Ts>...>::value, std::nullptr_t>::type = nullptr>
+  constexpr explicit packed_tuple(Us&&... us) noexcept(conjunction<std::is_nothrow_constructible<Ts, Us>...>::value)
+      : storage_type(in_place, std::forward<Us>(us)...)
+  {
+  }
+
+  template<class Dummy = void, typename std::enable_if<detail::is_packed_tuple_swappable<Ts...>::value && std::is_void<Dummy>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX14_CONSTEXPR void swap(packed_tuple& other) noexcept(detail::is_packed_tuple_nothrow_swappable<Ts...>::value)
+  {
+    this->swap_impl(other, index_sequence_for<Ts...>{});
+  }
+
+private:
+  template<std::size_t... Is>
+  YK_POLYFILL_CXX14_CONSTEXPR void swap_impl(packed_tuple& other, index_sequence<Is...>)
+  {
+    using expand = int[];
+    (void)expand{0, (polyfill::detail::constexpr_swap(detail::packed_tuple_access::get<Is>(*this), detail::packed_tuple_access::get<Is>(other)), 0)...};
+  }
+};
+
+// get
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename pack_indexing<I, Ts...>::type& get(packed_tuple<Ts...>& t) noexcept
+{
+  static_assert(I < sizeof...(Ts), "I must be in sizeof...(Ts)");
+  return detail::packed_tuple_access::get<I>(t);
+}
+
+template<std::size_t I, class... Ts>
+constexpr typename pack_indexing<I, Ts...>::type const& get(packed_tuple<Ts...> const& t) noexcept
+{
+  static_assert(I < sizeof...(Ts), "I must be in sizeof...(Ts)");
+  return detail::packed_tuple_access::get<I>(t);
+}
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename pack_indexing<I, Ts...>::type&& get(packed_tuple<Ts...>&& t) noexcept
+{
+  static_assert(I < sizeof...(Ts), "I must be in sizeof...(Ts)");
+  return std::forward<typename pack_indexing<I, Ts...>::type>(detail::packed_tuple_access::get<I>(t));
+}
+
+template<std::size_t I, class... Ts>
+constexpr typename pack_indexing<I, Ts...>::type const&& get(packed_tuple<Ts...> const&& t) noexcept
+{
+  static_assert(I < sizeof...(Ts), "I must be in sizeof...(Ts)");
+  return std::forward<typename pack_indexing<I, Ts...>::type const>(detail::packed_tuple_access::get<I>(t));
+}
+
+// make_packed_tuple
+
+template<class... Us>
+constexpr packed_tuple<typename std::decay<Us>::type...> make_packed_tuple(Us&&... us)
+{
+  return packed_tuple<typename std::decay<Us>::type...>(std::forward<Us>(us)...);
+}
+
+// comparison operators (lexicographic, in declared order)
+
+template<class... Ts, class... Us, typename std::enable_if<sizeof...(Ts) == sizeof...(Us), std::nullptr_t>::type = nullptr>
+constexpr bool operator==(packed_tuple<Ts...> const& lhs, packed_tuple<Us...> const& rhs)
+{
+  return detail::packed_tuple_compare<0, sizeof...(Ts)>::eq(lhs, rhs);
+}
+
+template<class... Ts, class... Us, typename std::enable_if<sizeof...(Ts) == sizeof...(Us), std::nullptr_t>::type = nullptr>
+constexpr bool operator!=(packed_tuple<Ts...> const& lhs, packed_tuple<Us...> const& rhs)
+{
+  return !(lhs == rhs);
+}
+
+template<class... Ts, class... Us, typename std::enable_if<sizeof...(Ts) == sizeof...(Us), std::nullptr_t>::type = nullptr>
+constexpr bool operator<(packed_tuple<Ts...> const& lhs, packed_tuple<Us...> const& rhs)
+{
+  return detail::packed_tuple_compare<0, sizeof...(Ts)>::lt(lhs, rhs);
+}
+
+template<class... Ts, class... Us, typename std::enable_if<sizeof...(Ts) == sizeof...(Us), std::nullptr_t>::type = nullptr>
+constexpr bool operator>(packed_tuple<Ts...> const& lhs, packed_tuple<Us...> const& rhs)
+{
+  return rhs < lhs;
+}
+
+template<class... Ts, class... Us, typename std::enable_if<sizeof...(Ts) == sizeof...(Us), std::nullptr_t>::type = nullptr>
+constexpr bool operator<=(packed_tuple<Ts...> const& lhs, packed_tuple<Us...> const& rhs)
+{
+  return !(rhs < lhs);
+}
+
+template<class... Ts, class... Us, typename std::enable_if<sizeof...(Ts) == sizeof...(Us), std::nullptr_t>::type = nullptr>
+constexpr bool operator>=(packed_tuple<Ts...> const& lhs, packed_tuple<Us...> const& rhs)
+{
+  return !(lhs < rhs);
+}
+
+// swap
+
+template<class... Ts, typename std::enable_if<detail::is_packed_tuple_swappable<Ts...>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_CXX14_CONSTEXPR void swap(packed_tuple<Ts...>& lhs, packed_tuple<Ts...>& rhs) noexcept(noexcept(lhs.swap(rhs)))
+{
+  lhs.swap(rhs);
+}
+
+}  // namespace extension
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+namespace std {
+
+template<class... Ts>
+struct tuple_size<yk::polyfill::extension::packed_tuple<Ts...>> : std::integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template<std::size_t I, class... Ts>
+struct tuple_element<I, yk::polyfill::extension::packed_tuple<Ts...>> {
+  using type = typename yk::polyfill::extension::pack_indexing<I, Ts...>::type;
+};
+
+}  // namespace std
+
+#endif  // YK_ZZ_POLYFILL_EXTENSION_PACKED_TUPLE_HPP
@@ -0,0 +1,469 @@
+#ifndef YK_ZZ_POLYFILL_EXTENSION_SOA_VECTOR_HPP
+#define YK_ZZ_POLYFILL_EXTENSION_SOA_VECTOR_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <yk/polyfill/bits/core_traits.hpp>
+
+#include <yk/polyfill/extension/pack_indexing.hpp>
+
+#include <yk/polyfill/tuple.hpp>
+#include <yk/polyfill/utility.hpp>
+
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+#if __cpp_lib_span >= 202002L
+#include <span>
+#endif
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+// soa_vector<Ts...>: a growable sequence of (Ts...) records stored as a structure of arrays, one contiguous
+// column per element type. v[i] is a proxy tuple<Ts&...> (so polyfill::apply and get<I> work on it, and
+// `v[i] = row` / swap(v[i], v[j]) write through to the columns), and
+// data<I>() / column<I>() expose column I as a plain array for vectorized kernels.
+//
+//   soa_vector<float, float, int> pts;
+//   pts.emplace_back(1.f, 2.f, 3);
+//   float* xs = pts.data<0>();  // xs[0 .. pts.size())
+
+namespace detail {
+
+template<class T>
+struct soa_column {
+  static T* allocate(std::size_t n) { return n == 0 ? nullptr : std::allocator<T>().allocate(n); }
+
+  static void deallocate(T* p, std::size_t n) noexcept
+  {
+    if (p != nullptr) std::allocator<T>().deallocate(p, n);
+  }
+
+  static void destroy(T* first, std::size_t n) noexcept
+  {
+    for (std::size_t i = 0; i != n; ++i) first[i].~T();
+  }
+
+  template<class... Args>
+  static void construct(T* p, Args&&... args)
+  {
+    ::new (static_cast<void*>(p)) T(std::forward<Args>(args)...);
+  }
+
+  // constructs dst[0 .. n) from `make(i)`; on exception destroys what was built and rethrows
+  template<class Make>
+  static void construct_n(T* dst, std::size_t n, Make make)
+  {
+    std::size_t i = 0;
+    try {
+      for (; i != n; ++i) construct(dst + i, make(i));
+    } catch (...) {
+      destroy(dst, i);
+      throw;
+    }
+  }
+};
+
+template<class T>
+struct soa_copy_from {
+  T const* src;
+  T const& operator()(std::size_t i) const noexcept { return src[i]; }
+};
+
+template<class T>
+struct soa_move_if_noexcept_from {
+  T* src;
+  auto operator()(std::size_t i) const noexcept -> decltype(std::move_if_noexcept(src[i])) { return std::move_if_noexcept(src[i]); }
+};
+
+template<class T>
+struct soa_value_init {
+  T operator()(std::size_t) const { return T(); }
+};
+
+// Runs op.construct<I>() for I = 0 .. N-1; if one throws, op.destroy<J>() undoes the columns J < I already done.
+template<std::size_t I, std::size_t N>
+struct soa_columnwise {
+  template<class Op>
+  static void construct(Op& op)
+  {
+    op.template construct<I>();
+    try {
+      soa_columnwise<I + 1, N>::construct(op);
+    } catch (...) {
+      op.template destroy<I>();
+      throw;
+    }
+  }
+};
+
+template<std::size_t N>
+struct soa_columnwise<N, N> {
+  template<class Op>
+  static void construct(Op&) noexcept
+  {
+  }
+};
+
+// Column pointers and the capacity they were allocated with. Owns the allocations, not the elements.
+template<class... Ts>
+struct soa_buffer {
+  tuple<Ts*...> columns;
+  std::size_t capacity;
+
+  soa_buffer() noexcept : columns(static_cast<Ts*>(nullptr)...), capacity(0) {}
+
+  soa_buffer(soa_buffer const&) = delete;
+  soa_buffer& operator=(soa_buffer const&) = delete;
+
+  soa_buffer(soa_buffer&& other) noexcept : columns(other.columns), capacity(other.capacity)
+  {
+    other.columns = tuple<Ts*...>(static_cast<Ts*>(nullptr)...);
+    other.capacity = 0;
+  }
+
+  ~soa_buffer() { deallocate(index_sequence_for<Ts...>{}); }
+
+  // precondition: nothing allocated yet; if an allocation throws, the destructor frees the others
+  void allocate(std::size_t n)
+  {
+    capacity = n;
+    allocate(n, index_sequence_for<Ts...>{});
+  }
+
+  void swap(soa_buffer& other) noexcept
+  {
+    std::swap(columns, other.columns);
+    std::swap(capacity, other.capacity);
+  }
+
+private:
+  template<std::size_t... Is>
+  void allocate(std::size_t n, index_sequence<Is...>)
+  {
+    using expand = int[];
+    (void)expand{0, (polyfill::get<Is>(columns) = soa_column<Ts>::allocate(n), 0)...};
+  }
+
+  template<std::size_t... Is>
+  void deallocate(index_sequence<Is...>) noexcept
+  {
+    using expand = int[];
+    (void)expand{0, (soa_column<Ts>::deallocate(polyfill::get<Is>(columns), capacity), 0)...};
+  }
+};
+
+}  // namespace detail
+
+template<class... Ts>
+class soa_vector {
+  static_assert(sizeof...(Ts) > 0, "soa_vector must have at least one column");
+  static_assert(conjunction<std::is_object<Ts>...>::value, "soa_vector columns must be object types");
+  static_assert(!disjunction<std::is_const<Ts>...>::value && !disjunction<std::is_volatile<Ts>...>::value, "soa_vector columns must not be cv-qualified");
+
+  using buffer_type = detail::soa_buffer<Ts...>;
+
+public:
+  using value_type = tuple<Ts...>;
+  using reference = tuple<Ts&...>;
+  using const_reference = tuple<Ts const&...>;
+  using size_type = std::size_t;
+
+  template<std::size_t I>
+  using column_type = typename pack_indexing<I, Ts...>::type;
+
+  soa_vector() noexcept : buf_(), size_(0) {}
+
+  explicit soa_vector(size_type n) : buf_(), size_(0)
+  {
+    buf_.allocate(n);
+    value_init_op op{buf_, n};
+    detail::soa_columnwise<0, sizeof...(Ts)>::construct(op);
+    size_ = n;
+  }
+
+  soa_vector(soa_vector const& other) : buf_(), size_(0)
+  {
+    buf_.allocate(other.size_);
+    copy_op op{buf_, other.buf_, other.size_};
+    detail::soa_columnwise<0, sizeof...(Ts)>::construct(op);
+    size_ = other.size_;
+  }
+
+  soa_vector(soa_vector&& other) noexcept : buf_(std::move(other.buf_)), size_(polyfill::exchange(other.size_, 0)) {}
+
+  // copy-and-swap; strong guarantee for copies
+  soa_vector& operator=(soa_vector other) noexcept
+  {
+    this->swap(other);
+    return *this;
+  }
+
+  ~soa_vector() { destroy_all(index_sequence_for<Ts...>{}); }
+
+  // capacity
+
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return buf_.capacity; }
+  YK_POLYFILL_NODISCARD bool empty() const noexcept { return size_ == 0; }
+
+  void reserve(size_type n)
+  {
+    if (n > buf_.capacity) reallocate(n);
+  }
+
+  // element access
+
+  reference operator[](size_type i) noexcept { return this->ref_at(i, index_sequence_for<Ts...>{}); }
+  const_reference operator[](size_type i) const noexcept { return this->cref_at(i, index_sequence_for<Ts...>{}); }
+
+  reference at(size_type i)
+  {
+    if (i >= size_) throw std::out_of_range("soa_vector::at");
+    return (*this)[i];
+  }
+
+  const_reference at(size_type i) const
+  {
+    if (i >= size_) throw std::out_of_range("soa_vector::at");
+    return (*this)[i];
+  }
+
+  reference front() noexcept { return (*this)[0]; }
+  const_reference front() const noexcept { return (*this)[0]; }
+  reference back() noexcept { return (*this)[size_ - 1]; }
+  const_reference back() const noexcept { return (*this)[size_ - 1]; }
+
+  // column access: data<I>()[0 .. size())
+
+  template<std::size_t I>
+  column_type<I>* data() noexcept
+  {
+    return polyfill::get<I>(buf_.columns);
+  }
+
+  template<std::size_t I>
+  column_type<I> const* data() const noexcept
+  {
+    return polyfill::get<I>(buf_.columns);
+  }
+
+#if __cpp_lib_span >= 202002L
+  template<std::size_t I>
+  std::span<column_type<I>> column() noexcept
+  {
+    return std::span<column_type<I>>(data<I>(), size_);
+  }
+
+  template<std::size_t I>
+  std::span<column_type<I> const> column() const noexcept
+  {
+    return std::span<column_type<I> const>(data<I>(), size_);
+  }
+#endif
+
+  // modifiers
+
+  // one argument per column; strong guarantee
+  template<
+      class... Us, typename std::enable_if<sizeof...(Us) == sizeof...(Ts), std::nullptr_t>::type = nullptr,
+      typename std::enable_if<conjunction<std::is_constructible<Ts, Us>...>::value, std::nullptr_t>::type = nullptr>
+  reference emplace_back(Us&&... us)
+  {
+    if (size_ != buf_.capacity) {
+      this->construct_row(buf_, std::forward<Us>(us)...);
+    } else {
+      // the arguments may refer to our own elements, so the new row is built before the old ones are moved away
+      buffer_type fresh;
+      fresh.allocate(size_ == 0 ? 1 : 2 * size_);
+      this->construct_row(fresh, std::forward<Us>(us)...);
+      try {
+        this->relocate_into(fresh);
+      } catch (...) {
+        this->destroy_at(fresh, size_, index_sequence_for<Ts...>{});
+        throw;
+      }
+    }
+    ++size_;
+    return back();
+  }
+
+  void push_back(value_type const& value) { this->push_back_impl(value, index_sequence_for<Ts...>{}); }
+  void push_back(value_type&& value) { this->push_back_impl(std::move(value), index_sequence_for<Ts...>{}); }
+
+  void pop_back() noexcept
+  {
+    --size_;
+    this->destroy_at(buf_, size_, index_sequence_for<Ts...>{});
+  }
+
+  void clear() noexcept
+  {
+    destroy_all(index_sequence_for<Ts...>{});
+    size_ = 0;
+  }
+
+  void swap(soa_vector& other) noexcept
+  {
+    buf_.swap(other.buf_);
+    std::swap(size_, other.size_);
+  }
+
+  friend void swap(soa_vector& a, soa_vector& b) noexcept { a.swap(b); }
+
+private:
+  buffer_type buf_;
+  size_type size_;
+
+  // column-wise construction steps for detail::soa_columnwise
+
+  struct value_init_op {
+    buffer_type& dst;
+    size_type n;
+
+    template<std::size_t I>
+    void construct()
+    {
+      detail::soa_column<column_type<I>>::construct_n(polyfill::get<I>(dst.columns), n, detail::soa_value_init<column_type<I>>{});
+    }
+
+    template<std::size_t I>
+    void destroy() noexcept
+    {
+      detail::soa_column<column_type<I>>::destroy(polyfill::get<I>(dst.columns), n);
+    }
+  };
+
+  struct copy_op {
+    buffer_type& dst;
+    buffer_type const& src;
+    size_type n;
+
+    template<std::size_t I>
+    void construct()
+    {
+      detail::soa_column<column_type<I>>::construct_n(
+          polyfill::get<I>(dst.columns), n, detail::soa_copy_from<column_type<I>>{polyfill::get<I>(src.columns)}
+      );
+    }
+
+    template<std::size_t I>
+    void destroy() noexcept
+    {
+      detail::soa_column<column_type<I>>::destroy(polyfill::get<I>(dst.columns), n);
+    }
+  };
+
+  struct move_if_noexcept_op {
+    buffer_type& dst;
+    buffer_type& src;
+    size_type n;
+
+    template<std::size_t I>
+    void construct()
+    {
+      detail::soa_column<column_type<I>>::construct_n(
+          polyfill::get<I>(dst.columns), n, detail::soa_move_if_noexcept_from<column_type<I>>{polyfill::get<I>(src.columns)}
+      );
+    }
+
+    template<std::size_t I>
+    void destroy() noexcept
+    {
+      detail::soa_column<column_type<I>>::destroy(polyfill::get<I>(dst.columns), n);
+    }
+  };
+
+  template<class... Args>
+  struct emplace_op {
+    buffer_type& dst;
+    size_type pos;
+    tuple<Args...> args;
+
+    template<std::size_t I>
+    void construct()
+    {
+      using Arg = typename pack_indexing<I, Args...>::type;
+      detail::soa_column<column_type<I>>::construct(polyfill::get<I>(dst.columns) + pos, std::forward<Arg>(polyfill::get<I>(args)));
+    }
+
+    template<std::size_t I>
+    void destroy() noexcept
+    {
+      detail::soa_column<column_type<I>>::destroy(polyfill::get<I>(dst.columns) + pos, 1);
+    }
+  };
+
+  void reallocate(size_type new_capacity)
+  {
+    buffer_type fresh;
+    fresh.allocate(new_capacity);
+    this->relocate_into(fresh);
+  }
+
+  // Builds every column in `fresh`, then destroys the old elements and adopts `fresh`; nothing changes on failure.
+  void relocate_into(buffer_type& fresh)
+  {
+    move_if_noexcept_op op{fresh, buf_, size_};
+    detail::soa_columnwise<0, sizeof...(Ts)>::construct(op);
+    destroy_all(index_sequence_for<Ts...>{});
+    buf_.swap(fresh);
+  }
+
+  // constructs row size_ of `dst`, one column at a time
+  template<class... Us>
+  void construct_row(buffer_type& dst, Us&&... us)
+  {
+    emplace_op<Us&&...> op{dst, size_, polyfill::forward_as_tuple(std::forward<Us>(us)...)};
+    detail::soa_columnwise<0, sizeof...(Ts)>::construct(op);
+  }
+
+  template<std::size_t... Is>
+  reference ref_at(size_type i, index_sequence<Is...>) noexcept
+  {
+    return reference(polyfill::get<Is>(buf_.columns)[i]...);
+  }
+
+  template<std::size_t... Is>
+  const_reference cref_at(size_type i, index_sequence<Is...>) const noexcept
+  {
+    return const_reference(polyfill::get<Is>(buf_.columns)[i]...);
+  }
+
+  template<class Tuple, std::size_t... Is>
+  void push_back_impl(Tuple&& value, index_sequence<Is...>)
+  {
+    this->emplace_back(polyfill::get<Is>(std::forward<Tuple>(value))...);
+  }
+
+  template<std::size_t... Is>
+  static void destroy_at(buffer_type& buf, size_type i, index_sequence<Is...>) noexcept
+  {
+    using expand = int[];
+    (void)expand{0, (detail::soa_column<Ts>::destroy(polyfill::get<Is>(buf.columns) + i, 1), 0)...};
+  }
+
+  template<std::size_t... Is>
+  void destroy_all(index_sequence<Is...>) noexcept
+  {
+    using expand = int[];
+    (void)expand{0, (detail::soa_column<Ts>::destroy(polyfill::get<Is>(buf_.columns), size_), 0)...};
+  }
+};
+
+}  // namespace extension
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+#endif  // YK_ZZ_POLYFILL_EXTENSION_SOA_VECTOR_HPP
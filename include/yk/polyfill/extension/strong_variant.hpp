@@ -0,0 +1,630 @@
+#ifndef YK_ZZ_POLYFILL_EXTENSION_STRONG_VARIANT_HPP
+#define YK_ZZ_POLYFILL_EXTENSION_STRONG_VARIANT_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <yk/polyfill/bits/cond_trivial_smf.hpp>
+#include <yk/polyfill/bits/core_traits.hpp>
+#include <yk/polyfill/bits/hash_mix.hpp>
+
+#include <yk/polyfill/extension/pack_indexing.hpp>
+
+#include <yk/polyfill/functional.hpp>
+#include <yk/polyfill/memory.hpp>
+#include <yk/polyfill/type_traits.hpp>
+#include <yk/polyfill/utility.hpp>
+#include <yk/polyfill/variant.hpp>
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+template<class... Ts>
+class strong_variant;
+
+namespace detail {
+
+// Same layout as variant's union, but flagged never-valueless so that raw_visit uses the unbiased index
+// and the dispatch table has no slot for the valueless state.
+template<class... Ts>
+struct strong_variadic_union : polyfill::detail::make_variadic_union<Ts...>::type {
+  using base = typename polyfill::detail::make_variadic_union<Ts...>::type;
+  using base::base;
+
+  static constexpr bool never_valueless = true;
+};
+
+}  // namespace detail
+
+}  // namespace extension
+
+namespace detail {
+
+template<std::size_t I, class... Ts>
+struct raw_get_result<I, extension::detail::strong_variadic_union<Ts...>&> {
+  using type = typename extension::pack_indexing<I, Ts...>::type&;
+};
+
+template<std::size_t I, class... Ts>
+struct raw_get_result<I, extension::detail::strong_variadic_union<Ts...> const&> {
+  using type = typename extension::pack_indexing<I, Ts...>::type const&;
+};
+
+template<std::size_t I, class... Ts>
+struct raw_get_result<I, extension::detail::strong_variadic_union<Ts...>&&> {
+  using type = typename extension::pack_indexing<I, Ts...>::type&&;
+};
+
+template<std::size_t I, class... Ts>
+struct raw_get_result<I, extension::detail::strong_variadic_union<Ts...> const&&> {
+  using type = typename extension::pack_indexing<I, Ts...>::type const&&;
+};
+
+}  // namespace detail
+
+namespace extension {
+
+namespace detail {
+
+template<class... Ts>
+struct strong_variant_storage;
+
+// Strong-guarantee emplace: the old alternative is destroyed only once nothing else can throw.
+// If T_i(args...) may throw, the new value is built in a temporary first and then moved in (nothrow by requirement).
+template<bool NothrowDirect>
+struct strong_emplace_operation;
+
+template<>
+struct strong_emplace_operation</* NothrowDirect = */ true> {
+  template<std::size_t I, class... Ts, class... Args>
+  static YK_POLYFILL_CXX20_CONSTEXPR void apply(strong_variant_storage<Ts...>& storage, Args&&... args) noexcept
+  {
+    storage.destroy();
+    polyfill::construct_at(&storage.vunion, in_place_index_t<I>{}, std::forward<Args>(args)...);
+    storage.vindex = I;
+  }
+};
+
+template<>
+struct strong_emplace_operation</* NothrowDirect = */ false> {
+  template<std::size_t I, class... Ts, class... Args>
+  static YK_POLYFILL_CXX20_CONSTEXPR void apply(strong_variant_storage<Ts...>& storage, Args&&... args)
+  {
+    using T_i = typename pack_indexing<I, Ts...>::type;
+    T_i tmp(std::forward<Args>(args)...);  // may throw; *this is untouched
+    storage.destroy();
+    polyfill::construct_at(&storage.vunion, in_place_index_t<I>{}, std::move(tmp));
+    storage.vindex = I;
+  }
+};
+
+template<class... Ts>
+struct strong_construct_visitor {
+  strong_variant_storage<Ts...>& storage;
+
+  template<std::size_t J, class OtherContainedT>
+  YK_POLYFILL_CXX20_CONSTEXPR void operator()(in_place_index_t<J>, OtherContainedT&& other_value) noexcept(
+      std::is_nothrow_constructible<typename remove_cvref<OtherContainedT>::type, OtherContainedT>::value
+  )
+  {
+    polyfill::construct_at(&storage.vunion, in_place_index_t<J>{}, std::forward<OtherContainedT>(other_value));
+    storage.vindex = J;
+  }
+};
+
+template<class... Ts>
+struct strong_assign_visitor {
+  strong_variant_storage<Ts...>& lhs;
+
+  template<std::size_t J, class RhsContainedT>
+  YK_POLYFILL_CXX20_CONSTEXPR void operator()(in_place_index_t<J>, RhsContainedT&& rhs_value) noexcept(
+      std::is_nothrow_assignable<typename remove_cvref<RhsContainedT>::type&, RhsContainedT>::value
+      && std::is_nothrow_constructible<typename remove_cvref<RhsContainedT>::type, RhsContainedT>::value
+  )
+  {
+    lhs.template assign<J>(std::forward<RhsContainedT>(rhs_value));
+  }
+};
+
+template<class... Ts>
+struct strong_variant_storage {
+  using union_type = strong_variadic_union<Ts...>;
+  using index_type = typename polyfill::detail::select_index<sizeof...(Ts)>::type;
+
+  union_type vunion;
+  index_type vindex;
+
+  // Transient state used only by cond_trivial_smf while a copy/move constructor runs.
+  explicit constexpr strong_variant_storage()
+      : vunion(polyfill::detail::valueless), vindex(polyfill::detail::variant_npos_for<sizeof...(Ts)>::value)
+  {
+  }
+
+  template<std::size_t I, class... Args>
+  constexpr explicit strong_variant_storage(in_place_index_t<I> ipi, Args&&... args) noexcept(
+      std::is_nothrow_constructible<typename pack_indexing<I, Ts...>::type, Args...>::value
+  )
+      : vunion(ipi, std::forward<Args>(args)...), vindex(I)
+  {
+  }
+
+  constexpr std::size_t index() const noexcept { return vindex; }
+
+  template<class Visitor>
+  YK_POLYFILL_CXX14_CONSTEXPR typename polyfill::detail::raw_visit_result<Visitor, union_type&>::type raw_visit(Visitor&& vis) &
+  {
+    return polyfill::detail::raw_visit_dispatch::apply(std::forward<Visitor>(vis), vunion, vindex);
+  }
+
+  template<class Visitor>
+  constexpr typename polyfill::detail::raw_visit_result<Visitor, union_type const&>::type raw_visit(Visitor&& vis) const&
+  {
+    return polyfill::detail::raw_visit_dispatch::apply(std::forward<Visitor>(vis), vunion, vindex);
+  }
+
+  template<class Visitor>
+  YK_POLYFILL_CXX14_CONSTEXPR typename polyfill::detail::raw_visit_result<Visitor, union_type&&>::type raw_visit(Visitor&& vis) &&
+  {
+    return polyfill::detail::raw_visit_dispatch::apply(std::forward<Visitor>(vis), std::move(vunion), vindex);
+  }
+
+  template<class Visitor>
+  constexpr typename polyfill::detail::raw_visit_result<Visitor, union_type const&&>::type raw_visit(Visitor&& vis) const&&
+  {
+    return polyfill::detail::raw_visit_dispatch::apply(std::forward<Visitor>(vis), std::move(vunion), vindex);
+  }
+
+  // destroys the contained value without touching the index
+  YK_POLYFILL_CXX20_CONSTEXPR void destroy() noexcept { raw_visit(polyfill::detail::destroy_visitor{}); }
+
+  template<std::size_t I, class... Args, class T_i = typename pack_indexing<I, Ts...>::type>
+  YK_POLYFILL_CXX20_CONSTEXPR T_i& emplace(Args&&... args) noexcept(std::is_nothrow_constructible<T_i, Args...>::value)
+  {
+    strong_emplace_operation<std::is_nothrow_constructible<T_i, Args...>::value>::template apply<I>(*this, std::forward<Args>(args)...);
+    return polyfill::detail::raw_get<I>(vunion);
+  }
+
+  template<std::size_t J, class Rhs, class T_j = typename pack_indexing<J, Ts...>::type>
+  YK_POLYFILL_CXX20_CONSTEXPR void assign(Rhs&& rhs) noexcept(std::is_nothrow_assignable<T_j&, Rhs>::value && std::is_nothrow_constructible<T_j, Rhs>::value)
+  {
+    if (vindex == J) {
+      polyfill::detail::raw_get<J>(vunion) = std::forward<Rhs>(rhs);
+    } else {
+      emplace<J>(std::forward<Rhs>(rhs));
+    }
+  }
+
+  // for cond_trivial_smf
+
+  YK_POLYFILL_CXX20_CONSTEXPR void _copy_construct(strong_variant_storage const& other) noexcept(conjunction<std::is_nothrow_copy_constructible<Ts>...>::value)
+  {
+    other.raw_visit(strong_construct_visitor<Ts...>{*this});
+  }
+
+  YK_POLYFILL_CXX20_CONSTEXPR void _move_construct(strong_variant_storage&& other) noexcept
+  {
+    std::move(other).raw_visit(strong_construct_visitor<Ts...>{*this});
+  }
+
+  YK_POLYFILL_CXX20_CONSTEXPR void _copy_assign(strong_variant_storage const& other) noexcept(
+      conjunction<std::is_nothrow_copy_constructible<Ts>..., std::is_nothrow_copy_assignable<Ts>...>::value
+  )
+  {
+    other.raw_visit(strong_assign_visitor<Ts...>{*this});
+  }
+
+  YK_POLYFILL_CXX20_CONSTEXPR void _move_assign(strong_variant_storage&& other) noexcept(conjunction<std::is_nothrow_move_assignable<Ts>...>::value)
+  {
+    std::move(other).raw_visit(strong_assign_visitor<Ts...>{*this});
+  }
+};
+
+template<bool TriviallyDestructible, class... Ts>
+struct strong_variant_base;
+
+template<class... Ts>
+struct strong_variant_base<true, Ts...> : strong_variant_storage<Ts...> {
+  using strong_variant_storage<Ts...>::strong_variant_storage;
+};
+
+template<class... Ts>
+struct strong_variant_base<false, Ts...> : strong_variant_storage<Ts...> {
+  using strong_variant_storage<Ts...>::strong_variant_storage;
+
+  // The npos check only matters if a copy constructor threw before any alternative was constructed.
+  YK_POLYFILL_CXX20_CONSTEXPR ~strong_variant_base()
+  {
+    if (this->vindex != polyfill::detail::variant_npos_for<sizeof...(Ts)>::value) this->destroy();
+  }
+};
+
+template<class... Ts>
+struct make_strong_variant_base {
+  using type = strong_variant_base<conjunction<std::is_trivially_destructible<Ts>...>::value, Ts...>;
+};
+
+struct strong_variant_access {
+  template<class V>
+  static constexpr auto vunion(V&& v) noexcept -> decltype((std::forward<V>(v).vunion))
+  {
+    return std::forward<V>(v).vunion;
+  }
+};
+
+template<class T>
+struct is_strong_variant : false_type {};
+
+template<class... Ts>
+struct is_strong_variant<strong_variant<Ts...>> : true_type {};
+
+}  // namespace detail
+
+// strong_variant<Ts...>: a variant that is never valueless.
+// Every alternative must be nothrow move constructible; a throwing emplace/assignment builds the new value
+// in a temporary first, so the variant keeps its old value on exception. In exchange, index() never yields
+// variant_npos and visitation needs neither the valueless check nor the extra dispatch slot.
+template<class... Ts>
+class strong_variant : private polyfill::detail::cond_trivial_smf<typename detail::make_strong_variant_base<Ts...>::type, Ts...> {
+  static_assert(sizeof...(Ts) > 0, "strong_variant must be instantiated with at least one type template parameter");
+  static_assert(conjunction<std::is_nothrow_move_constructible<Ts>...>::value, "strong_variant requires every alternative to be nothrow move constructible");
+
+private:
+  using base_type = polyfill::detail::cond_trivial_smf<typename detail::make_strong_variant_base<Ts...>::type, Ts...>;
+
+  friend struct detail::strong_variant_access;
+
+public:
+  using base_type::index;
+
+  constexpr bool valueless_by_exception() const noexcept { return false; }
+
+  template<
+      class Head = typename pack_indexing<0, Ts...>::type,
+      typename std::enable_if<std::is_default_constructible<Head>::value, std::nullptr_t>::type = nullptr>
+  constexpr strong_variant() noexcept(std::is_nothrow_default_constructible<Head>::value) : base_type(in_place_index_t<0>{})
+  {
+  }
+
+  template<
+      class T, typename std::enable_if<!std::is_same<typename remove_cvref<T>::type, strong_variant>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<!polyfill::detail::is_in_place_type<typename remove_cvref<T>::type>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<!polyfill::detail::is_in_place_index<typename remove_cvref<T>::type>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<polyfill::detail::is_invocation_to_imaginary_function_set_valid<T, Ts...>::value, std::nullptr_t>::type = nullptr,
+      std::size_t SelectedIndex = polyfill::detail::select_alternative<T, Ts...>::value,
+      class SelectedType = typename pack_indexing<SelectedIndex, Ts...>::type,
+      typename std::enable_if<std::is_constructible<SelectedType, T>::value, std::nullptr_t>::type = nullptr>
+  constexpr strong_variant(T&& t) noexcept(std::is_nothrow_constructible<SelectedType, T>::value)
+      : base_type(in_place_index_t<SelectedIndex>{}, std::forward<T>(t))
+  {
+  }
+
+  template<
+      std::size_t I, class... Args, class SelectedType = typename pack_indexing<I, Ts...>::type,
+      typename std::enable_if<std::is_constructible<SelectedType, Args...>::value, std::nullptr_t>::type = nullptr>
+  constexpr explicit strong_variant(in_place_index_t<I> ipi, Args&&... args) noexcept(std::is_nothrow_constructible<SelectedType, Args...>::value)
+      : base_type(ipi, std::forward<Args>(args)...)
+  {
+  }
+
+  template<
+      class T, class... Args, typename std::enable_if<polyfill::detail::exactly_once<T, Ts...>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<std::is_constructible<T, Args...>::value, std::nullptr_t>::type = nullptr>
+  constexpr explicit strong_variant(in_place_type_t<T>, Args&&... args) noexcept(std::is_nothrow_constructible<T, Args...>::value)
+      : base_type(in_place_index_t<polyfill::detail::find_index<T, Ts...>::value>{}, std::forward<Args>(args)...)
+  {
+  }
+
+  template<
+      std::size_t I, class... Args, class SelectedType = typename pack_indexing<I, Ts...>::type,
+      typename std::enable_if<std::is_constructible<SelectedType, Args...>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX20_CONSTEXPR SelectedType& emplace(Args&&... args) noexcept(std::is_nothrow_constructible<SelectedType, Args...>::value)
+  {
+    return base_type::template emplace<I>(std::forward<Args>(args)...);
+  }
+
+  template<
+      std::size_t I, class U, class... Args, class SelectedType = typename pack_indexing<I, Ts...>::type,
+      typename std::enable_if<std::is_constructible<SelectedType, std::initializer_list<U>&, Args...>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX20_CONSTEXPR SelectedType& emplace(std::initializer_list<U> il, Args&&... args) noexcept(
+      std::is_nothrow_constructible<SelectedType, std::initializer_list<U>&, Args...>::value
+  )
+  {
+    return base_type::template emplace<I>(il, std::forward<Args>(args)...);
+  }
+
+  template<
+      class T, class... Args, typename std::enable_if<polyfill::detail::exactly_once<T, Ts...>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<std::is_constructible<T, Args...>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX20_CONSTEXPR T& emplace(Args&&... args) noexcept(std::is_nothrow_constructible<T, Args...>::value)
+  {
+    return base_type::template emplace<polyfill::detail::find_index<T, Ts...>::value>(std::forward<Args>(args)...);
+  }
+
+  template<
+      class T, class U, class... Args, typename std::enable_if<polyfill::detail::exactly_once<T, Ts...>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<std::is_constructible<T, std::initializer_list<U>&, Args...>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX20_CONSTEXPR T& emplace(std::initializer_list<U> il, Args&&... args) noexcept(
+      std::is_nothrow_constructible<T, std::initializer_list<U>&, Args...>::value
+  )
+  {
+    return base_type::template emplace<polyfill::detail::find_index<T, Ts...>::value>(il, std::forward<Args>(args)...);
+  }
+
+  template<
+      class T, typename std::enable_if<!std::is_same<typename remove_cvref<T>::type, strong_variant>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<polyfill::detail::is_invocation_to_imaginary_function_set_valid<T, Ts...>::value, std::nullptr_t>::type = nullptr,
+      std::size_t SelectedIndex = polyfill::detail::select_alternative<T, Ts...>::value,
+      class SelectedType = typename pack_indexing<SelectedIndex, Ts...>::type,
+      typename std::enable_if<conjunction<std::is_assignable<SelectedType&, T>, std::is_constructible<SelectedType, T>>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX20_CONSTEXPR strong_variant& operator=(T&& t) noexcept(
+      conjunction<std::is_nothrow_assignable<SelectedType&, T>, std::is_nothrow_constructible<SelectedType, T>>::value
+  )
+  {
+    base_type::template assign<SelectedIndex>(std::forward<T>(t));
+    return *this;
+  }
+
+  YK_POLYFILL_CXX20_CONSTEXPR void swap(strong_variant& other) noexcept(conjunction<is_nothrow_swappable<Ts>...>::value)
+  {
+    if (index() == other.index()) {
+      this->raw_visit(swap_same_index_visitor{other});
+    } else {
+      strong_variant tmp(std::move(other));
+      other = std::move(*this);
+      *this = std::move(tmp);
+    }
+  }
+
+  using base_type::raw_visit;
+
+private:
+  struct swap_same_index_visitor {
+    strong_variant& other;
+
+    template<std::size_t I, class ContainedT>
+    YK_POLYFILL_CXX20_CONSTEXPR void operator()(in_place_index_t<I>, ContainedT& lhs_val) const
+    {
+      using std::swap;
+      swap(lhs_val, polyfill::detail::raw_get<I>(detail::strong_variant_access::vunion(other)));
+    }
+  };
+};
+
+// get<I>
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename pack_indexing<I, Ts...>::type& get(strong_variant<Ts...>& v)
+{
+  static_assert(I < sizeof...(Ts), "I must be in sizeof...(Ts)");
+  if (v.index() == I) {
+    return polyfill::detail::raw_get<I>(detail::strong_variant_access::vunion(v));
+  }
+  throw bad_variant_access{};
+}
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename pack_indexing<I, Ts...>::type const& get(strong_variant<Ts...> const& v)
+{
+  static_assert(I < sizeof...(Ts), "I must be in sizeof...(Ts)");
+  if (v.index() == I) {
+    return polyfill::detail::raw_get<I>(detail::strong_variant_access::vunion(v));
+  }
+  throw bad_variant_access{};
+}
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename pack_indexing<I, Ts...>::type&& get(strong_variant<Ts...>&& v)
+{
+  static_assert(I < sizeof...(Ts), "I must be in sizeof...(Ts)");
+  if (v.index() == I) {
+    return polyfill::detail::raw_get<I>(detail::strong_variant_access::vunion(std::move(v)));
+  }
+  throw bad_variant_access{};
+}
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename pack_indexing<I, Ts...>::type const&& get(strong_variant<Ts...> const&& v)
+{
+  static_assert(I < sizeof...(Ts), "I must be in sizeof...(Ts)");
+  if (v.index() == I) {
+    return polyfill::detail::raw_get<I>(detail::strong_variant_access::vunion(std::move(v)));
+  }
+  throw bad_variant_access{};
+}
+
+// get<T>
+
+template<class T, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR T& get(strong_variant<Ts...>& v)
+{
+  static_assert(polyfill::detail::exactly_once<T, Ts...>::value, "T must occur exactly once in Ts...");
+  return extension::get<polyfill::detail::find_index<T, Ts...>::value>(v);
+}
+
+template<class T, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR T const& get(strong_variant<Ts...> const& v)
+{
+  static_assert(polyfill::detail::exactly_once<T, Ts...>::value, "T must occur exactly once in Ts...");
+  return extension::get<polyfill::detail::find_index<T, Ts...>::value>(v);
+}
+
+template<class T, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR T&& get(strong_variant<Ts...>&& v)
+{
+  static_assert(polyfill::detail::exactly_once<T, Ts...>::value, "T must occur exactly once in Ts...");
+  return extension::get<polyfill::detail::find_index<T, Ts...>::value>(std::move(v));
+}
+
+template<class T, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR T const&& get(strong_variant<Ts...> const&& v)
+{
+  static_assert(polyfill::detail::exactly_once<T, Ts...>::value, "T must occur exactly once in Ts...");
+  return extension::get<polyfill::detail::find_index<T, Ts...>::value>(std::move(v));
+}
+
+// get_if
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename std::add_pointer<typename pack_indexing<I, Ts...>::type>::type get_if(strong_variant<Ts...>* v) noexcept
+{
+  static_assert(I < sizeof...(Ts), "I must be in sizeof...(Ts)");
+  return v && v->index() == I ? std::addressof(polyfill::detail::raw_get<I>(detail::strong_variant_access::vunion(*v))) : nullptr;
+}
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename std::add_pointer<typename pack_indexing<I, Ts...>::type const>::type get_if(strong_variant<Ts...> const* v) noexcept
+{
+  static_assert(I < sizeof...(Ts), "I must be in sizeof...(Ts)");
+  return v && v->index() == I ? std::addressof(polyfill::detail::raw_get<I>(detail::strong_variant_access::vunion(*v))) : nullptr;
+}
+
+template<class T, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename std::add_pointer<T>::type get_if(strong_variant<Ts...>* v) noexcept
+{
+  static_assert(polyfill::detail::exactly_once<T, Ts...>::value, "T must occur exactly once in Ts...");
+  return extension::get_if<polyfill::detail::find_index<T, Ts...>::value>(v);
+}
+
+template<class T, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename std::add_pointer<T const>::type get_if(strong_variant<Ts...> const* v) noexcept
+{
+  static_assert(polyfill::detail::exactly_once<T, Ts...>::value, "T must occur exactly once in Ts...");
+  return extension::get_if<polyfill::detail::find_index<T, Ts...>::value>(v);
+}
+
+template<class T, class... Ts>
+constexpr bool holds_alternative(strong_variant<Ts...> const& v) noexcept
+{
+  static_assert(polyfill::detail::exactly_once<T, Ts...>::value, "T must occur exactly once in Ts...");
+  return v.index() == polyfill::detail::find_index<T, Ts...>::value;
+}
+
+// visit: dispatches straight on index(); there is no valueless check and nothing to throw
+
+namespace detail {
+
+template<class R, class Visitor>
+struct strong_visit_adaptor {
+  Visitor&& vis;
+
+  template<std::size_t I, class ContainedT>
+  YK_POLYFILL_CXX14_CONSTEXPR R operator()(in_place_index_t<I>, ContainedT&& val) const
+  {
+    return polyfill::invoke(std::forward<Visitor>(vis), std::forward<ContainedT>(val));
+  }
+};
+
+template<class Visitor, class V>
+using strong_visit_result = typename invoke_result<Visitor, decltype(extension::get<0>(std::declval<V>()))>::type;
+
+}  // namespace detail
+
+template<
+    class Visitor, class V, typename std::enable_if<detail::is_strong_variant<typename remove_cvref<V>::type>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_CXX14_CONSTEXPR detail::strong_visit_result<Visitor, V> visit(Visitor&& vis, V&& v)
+{
+  return std::forward<V>(v).raw_visit(detail::strong_visit_adaptor<detail::strong_visit_result<Visitor, V>, Visitor>{std::forward<Visitor>(vis)});
+}
+
+template<class... Ts, typename std::enable_if<conjunction<is_swappable<Ts>...>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_CXX20_CONSTEXPR void swap(strong_variant<Ts...>& lhs, strong_variant<Ts...>& rhs) noexcept(noexcept(lhs.swap(rhs)))
+{
+  lhs.swap(rhs);
+}
+
+// comparisons: same table-free dispatch as variant, minus the valueless checks
+
+namespace detail {
+
+template<class Operation, class... Ts>
+constexpr typename Operation::result_type strong_variant_compare(strong_variant<Ts...> const& lhs, strong_variant<Ts...> const& rhs)
+{
+  return polyfill::detail::cmp_dispatch<Operation, 0, sizeof...(Ts)>::apply(
+      strong_variant_access::vunion(lhs), strong_variant_access::vunion(rhs), lhs.index()
+  );
+}
+
+}  // namespace detail
+
+template<class... Ts>
+constexpr bool operator==(strong_variant<Ts...> const& lhs, strong_variant<Ts...> const& rhs)
+{
+  return lhs.index() == rhs.index() && detail::strong_variant_compare<polyfill::detail::eq_operation>(lhs, rhs);
+}
+
+template<class... Ts>
+constexpr bool operator!=(strong_variant<Ts...> const& lhs, strong_variant<Ts...> const& rhs)
+{
+  return !(lhs == rhs);
+}
+
+template<class... Ts>
+constexpr bool operator<(strong_variant<Ts...> const& lhs, strong_variant<Ts...> const& rhs)
+{
+  return lhs.index() != rhs.index() ? lhs.index() < rhs.index() : detail::strong_variant_compare<polyfill::detail::lt_operation>(lhs, rhs);
+}
+
+template<class... Ts>
+constexpr bool operator>(strong_variant<Ts...> const& lhs, strong_variant<Ts...> const& rhs)
+{
+  return rhs < lhs;
+}
+
+template<class... Ts>
+constexpr bool operator<=(strong_variant<Ts...> const& lhs, strong_variant<Ts...> const& rhs)
+{
+  return !(rhs < lhs);
+}
+
+template<class... Ts>
+constexpr bool operator>=(strong_variant<Ts...> const& lhs, strong_variant<Ts...> const& rhs)
+{
+  return !(lhs < rhs);
+}
+
+namespace detail {
+
+template<class V, class = void>
+struct strong_variant_hash {};
+
+template<class... Ts>
+struct strong_variant_hash<strong_variant<Ts...>, void_t<decltype(std::hash<typename std::remove_const<Ts>::type>{}(std::declval<Ts const&>()))...>> {
+  std::size_t operator()(strong_variant<Ts...> const& v) const
+      noexcept(conjunction<bool_constant<noexcept(std::hash<typename std::remove_const<Ts>::type>{}(std::declval<Ts const&>()))>...>::value)
+  {
+    return v.raw_visit(polyfill::detail::hash_visitor<Ts...>{});
+  }
+};
+
+}  // namespace detail
+
+}  // namespace extension
+
+template<class... Ts>
+struct variant_size<extension::strong_variant<Ts...>> : integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template<std::size_t I, class... Ts>
+struct variant_alternative<I, extension::strong_variant<Ts...>> : extension::pack_indexing<I, Ts...> {};
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+namespace std {
+
+template<class... Ts>
+struct hash<yk::polyfill::extension::strong_variant<Ts...>> : yk::polyfill::extension::detail::strong_variant_hash<yk::polyfill::extension::strong_variant<Ts...>> {};
+
+}  // namespace std
+
+#endif  // YK_ZZ_POLYFILL_EXTENSION_STRONG_VARIANT_HPP
@@ -3,6 +3,7 @@
 
 #include <yk/polyfill/config.hpp>
 
+#include <yk/polyfill/bits/hash_mix.hpp>
 #include <yk/polyfill/bits/optional_common.hpp>
 
 #include <yk/polyfill/extension/specialization_of.hpp>
@@ -13,6 +14,7 @@
 #include <yk/polyfill/utility.hpp>
 
 #include <exception>
+#include <functional>
 #include <initializer_list>
 #include <memory>
 #include <type_traits>
@@ -126,6 +128,7 @@ public:
 
 private:
   friend toptional<T, Traits>;
+  friend toptional<T&, Traits>;
 
   constexpr toptional_iterator(pointer ptr) noexcept : ptr_(ptr) {}
 
@@ -164,7 +167,6 @@ struct tombstone_value_for {
 // Mandates: invocation of Traits::tombstone_value() never throws
 template<class T, class Traits = non_zero_traits<T>>
 class toptional {
-  static_assert(!std::is_reference<T>::value, "toptional doesn't support reference type");
   static_assert(noexcept(Traits::tombstone_value()), "Traits::tombstone_value() must be noexcept");
 
 public:
@@ -574,6 +576,180 @@ private:
   T data;
 };
 
+// Reference specialization: stores a single `T*` and uses nullptr as the tombstone, so `Traits` is unused.
+template<class T, class Traits>
+class toptional<T&, Traits> {
+public:
+  using value_type = T;
+
+  constexpr toptional() noexcept = default;
+  constexpr toptional(nullopt_t) noexcept {}
+
+  template<
+      class Arg,
+      typename std::enable_if<std::is_constructible<T&, Arg>::value && !polyfill::detail::reference_constructs_from_temporary<T&, Arg>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX17_CONSTEXPR explicit toptional(in_place_t, Arg&& arg) noexcept(std::is_nothrow_constructible<T&, Arg>::value)
+  {
+    convert_ref_init_val(std::forward<Arg>(arg));
+  }
+
+  template<
+      class U, typename std::enable_if<
+                   !detail::is_toptional<typename remove_cvref<U>::type>::value && !std::is_same<typename remove_cvref<U>::type, in_place_t>::value
+                       && std::is_constructible<T&, U>::value && std::is_convertible<U, T&>::value
+                       && !polyfill::detail::reference_constructs_from_temporary<T&, U>::value,
+                   std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX17_CONSTEXPR toptional(U&& u) noexcept(std::is_nothrow_constructible<T&, U>::value)
+  {
+    convert_ref_init_val(std::forward<U>(u));
+  }
+
+  template<
+      class U, typename std::enable_if<
+                   !detail::is_toptional<typename remove_cvref<U>::type>::value && !std::is_same<typename remove_cvref<U>::type, in_place_t>::value
+                       && std::is_constructible<T&, U>::value && !std::is_convertible<U, T&>::value
+                       && !polyfill::detail::reference_constructs_from_temporary<T&, U>::value,
+                   std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX17_CONSTEXPR explicit toptional(U&& u) noexcept(std::is_nothrow_constructible<T&, U>::value)
+  {
+    convert_ref_init_val(std::forward<U>(u));
+  }
+
+  // binding to a temporary would dangle as soon as the full-expression ends
+  template<
+      class U, typename std::enable_if<
+                   !detail::is_toptional<typename remove_cvref<U>::type>::value && !std::is_same<typename remove_cvref<U>::type, in_place_t>::value
+                       && std::is_constructible<T&, U>::value && polyfill::detail::reference_constructs_from_temporary<T&, U>::value,
+                   std::nullptr_t>::type = nullptr>
+  toptional(U&& u) = delete;
+
+  template<
+      class U, class UTraits,
+      typename std::enable_if<!std::is_same<T, U>::value && std::is_convertible<U*, T*>::value, std::nullptr_t>::type = nullptr>
+  constexpr toptional(toptional<U&, UTraits> const& other) noexcept : ptr(other.operator->())
+  {
+  }
+
+  toptional(toptional const&) = default;
+  toptional& operator=(toptional const&) = default;
+
+  YK_POLYFILL_CXX14_CONSTEXPR toptional& operator=(nullopt_t) noexcept
+  {
+    ptr = nullptr;
+    return *this;
+  }
+
+  template<
+      class U, typename std::enable_if<std::is_constructible<T&, U>::value && !polyfill::detail::reference_constructs_from_temporary<T&, U>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX17_CONSTEXPR T& emplace(U&& u) noexcept(std::is_nothrow_constructible<T&, U>::value)
+  {
+    convert_ref_init_val(std::forward<U>(u));
+    return **this;
+  }
+
+  template<
+      class U, typename std::enable_if<std::is_constructible<T&, U>::value && polyfill::detail::reference_constructs_from_temporary<T&, U>::value, std::nullptr_t>::type = nullptr>
+  T& emplace(U&& u) = delete;
+
+  YK_POLYFILL_CXX14_CONSTEXPR void swap(toptional& other) noexcept
+  {
+    T* tmp = ptr;
+    ptr = other.ptr;
+    other.ptr = tmp;
+  }
+
+  constexpr T* operator->() const noexcept { return ptr; }
+
+  constexpr T& operator*() const noexcept { return *ptr; }
+
+  constexpr explicit operator bool() const noexcept { return ptr != nullptr; }
+
+  constexpr bool has_value() const noexcept { return ptr != nullptr; }
+
+  YK_POLYFILL_CXX14_CONSTEXPR T& value() const
+  {
+    if (has_value()) {
+      return **this;
+    } else {
+      throw bad_optional_access{};
+    }
+  }
+
+  template<class U = typename std::remove_cv<T>::type>
+  YK_POLYFILL_CXX14_CONSTEXPR typename std::remove_cv<T>::type value_or(U&& u) const
+  {
+    static_assert(
+        conjunction<std::is_constructible<typename std::remove_cv<T>::type, T&>, std::is_convertible<U&&, typename std::remove_cv<T>::type>>::value,
+        "argument must be convertible to T"
+    );
+    if (has_value()) {
+      return **this;
+    } else {
+      return std::forward<U>(u);
+    }
+  }
+
+  YK_POLYFILL_CXX14_CONSTEXPR void reset() noexcept { ptr = nullptr; }
+
+  template<class F>
+  YK_POLYFILL_CXX14_CONSTEXPR auto and_then(F&& f) const noexcept(is_nothrow_invocable<F, T&>::value) ->
+      typename remove_cvref<typename invoke_result<F, T&>::type>::type
+  {
+    using U = typename invoke_result<F, T&>::type;
+    static_assert(detail::is_toptional<typename remove_cvref<U>::type>::value, "result type of F must be specialization of toptional");
+    if (has_value()) {
+      return invoke(std::forward<F>(f), **this);
+    } else {
+      return nullopt;
+    }
+  }
+
+  template<class UTraits = void, class F>
+  YK_POLYFILL_CXX14_CONSTEXPR auto transform(F&& f) const noexcept(is_nothrow_invocable<F, T&>::value) -> typename std::conditional<
+      std::is_void<UTraits>::value, toptional<typename std::remove_cv<typename invoke_result<F, T&>::type>::type>,
+      toptional<typename std::remove_cv<typename invoke_result<F, T&>::type>::type, UTraits>>::type
+  {
+    using U = typename std::remove_cv<typename invoke_result<F, T&>::type>::type;
+    using ResultType = typename std::conditional<std::is_void<UTraits>::value, toptional<U>, toptional<U, UTraits>>::type;
+    static_assert(std::is_constructible<U, typename invoke_result<F, T&>::type>::value, "result type of F must be copy/move constructible");
+    if (has_value()) {
+      return ResultType(invoke(std::forward<F>(f), **this));
+    } else {
+      return nullopt;
+    }
+  }
+
+  template<class F, typename std::enable_if<is_invocable<F>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX14_CONSTEXPR toptional or_else(F&& f) const noexcept(is_nothrow_invocable<F>::value)
+  {
+    static_assert(
+        std::is_same<typename remove_cvref<typename invoke_result<F>::type>::type, toptional>::value, "result type of F must be equal to toptional<T&>"
+    );
+    if (has_value()) {
+      return *this;
+    } else {
+      return invoke(std::forward<F>(f));
+    }
+  }
+
+  using iterator = detail::toptional_iterator<T, Traits, false>;
+  using const_iterator = detail::toptional_iterator<T, Traits, true>;
+
+  constexpr iterator begin() const noexcept { return iterator{ptr}; }
+
+  constexpr iterator end() const noexcept { return iterator{ptr + has_value()}; }
+
+private:
+  template<class U>
+  YK_POLYFILL_CXX17_CONSTEXPR void convert_ref_init_val(U&& u) noexcept(std::is_nothrow_constructible<T&, U>::value)
+  {
+    T& r(std::forward<U>(u));
+    ptr = std::addressof(r);
+  }
+
+  T* ptr = nullptr;
+};
+
 template<
     class T, class TTraits, class U, class UTraits,
     typename std::enable_if<std::is_convertible<decltype(std::declval<T const&>() == std::declval<U const&>()), bool>::value, std::nullptr_t>::type = nullptr>
@@ -885,10 +1061,34 @@ constexpr toptional<T, Traits> make_toptional(std::initializer_list<U> il, Args&
   return toptional<T, Traits>(in_place, il, std::forward<Args>(args)...);
 }
 
+namespace detail {
+
+// Same scheme as optional: the tombstone is never passed to std::hash<T>, so all disengaged values hash alike.
+template<class T, class Traits, class = void>
+struct toptional_hash {};
+
+template<class T, class Traits>
+struct toptional_hash<T, Traits, void_t<decltype(std::hash<typename std::remove_const<T>::type>{}(std::declval<T const&>()))>> {
+  std::size_t operator()(toptional<T, Traits> const& opt) const noexcept(noexcept(std::hash<typename std::remove_const<T>::type>{}(*opt)))
+  {
+    return opt.has_value() ? std::hash<typename std::remove_const<T>::type>{}(*opt) : polyfill::detail::hash_disengaged;
+  }
+};
+
+}  // namespace detail
+
 }  // namespace extension
 
 }  // namespace polyfill
 
 }  // namespace yk
 
+// Hash specialization
+namespace std {
+
+template<class T, class Traits>
+struct hash<yk::polyfill::extension::toptional<T, Traits>> : yk::polyfill::extension::detail::toptional_hash<T, Traits> {};
+
+}  // namespace std
+
 #endif  // YK_ZZ_POLYFILL_EXTENSION_TOPTIONAL_HPP
@@ -0,0 +1,246 @@
+#ifndef YK_ZZ_POLYFILL_EXTENSION_UNIQUE_ARRAY_HPP
+#define YK_ZZ_POLYFILL_EXTENSION_UNIQUE_ARRAY_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <yk/polyfill/bits/core_traits.hpp>
+#include <yk/polyfill/bits/swap.hpp>
+
+#include <yk/polyfill/extension/ebo_storage.hpp>
+
+#include <yk/polyfill/memory.hpp>
+#include <yk/polyfill/utility.hpp>
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+#if __cpp_lib_span >= 202002L
+#include <span>
+#endif
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+namespace detail {
+
+// Deleters callable as `d(p, n)` receive the element count (sized deallocation); others are called as `d(p)`.
+template<class Deleter, class Pointer, class = void>
+struct is_sized_deleter : false_type {};
+
+template<class Deleter, class Pointer>
+struct is_sized_deleter<Deleter, Pointer, void_t<decltype(std::declval<Deleter&>()(std::declval<Pointer>(), std::declval<std::size_t>()))>> : true_type {};
+
+template<class Deleter, class Pointer, typename std::enable_if<is_sized_deleter<Deleter, Pointer>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_CXX20_CONSTEXPR void invoke_deleter(Deleter& d, Pointer p, std::size_t n) noexcept
+{
+  d(p, n);
+}
+
+template<class Deleter, class Pointer, typename std::enable_if<!is_sized_deleter<Deleter, Pointer>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_CXX20_CONSTEXPR void invoke_deleter(Deleter& d, Pointer p, std::size_t) noexcept
+{
+  d(p);
+}
+
+}  // namespace detail
+
+// unique_array<T, Deleter>: owning `T*` + length pair, i.e. `unique_ptr<T[], Deleter>` that remembers its size.
+// Like `unique_ptr` and `span`, constness is shallow: a const unique_array still gives mutable access to its elements.
+template<class T, class Deleter = default_delete<T[]>>
+class unique_array : ebo_storage<Deleter> {
+  static_assert(!std::is_array<T>::value, "T must not be an array type");
+  static_assert(!std::is_reference<Deleter>::value, "Deleter must not be a reference type");
+
+  using deleter_base = ebo_storage<Deleter>;
+
+public:
+  using element_type = T;
+  using value_type = typename std::remove_cv<T>::type;
+  using deleter_type = Deleter;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+  using iterator = T*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+
+  template<class D = Deleter, typename std::enable_if<std::is_default_constructible<D>::value, std::nullptr_t>::type = nullptr>
+  constexpr unique_array() noexcept : deleter_base(), ptr_(nullptr), size_(0)
+  {
+  }
+
+  template<class D = Deleter, typename std::enable_if<std::is_default_constructible<D>::value, std::nullptr_t>::type = nullptr>
+  constexpr unique_array(std::nullptr_t) noexcept : deleter_base(), ptr_(nullptr), size_(0)
+  {
+  }
+
+  template<class D = Deleter, typename std::enable_if<std::is_default_constructible<D>::value, std::nullptr_t>::type = nullptr>
+  constexpr explicit unique_array(pointer p, size_type n) noexcept : deleter_base(), ptr_(p), size_(n)
+  {
+  }
+
+  template<class D, typename std::enable_if<std::is_constructible<Deleter, D>::value, std::nullptr_t>::type = nullptr>
+  constexpr explicit unique_array(pointer p, size_type n, D&& d) noexcept(std::is_nothrow_constructible<Deleter, D>::value)
+      : deleter_base(std::forward<D>(d)), ptr_(p), size_(n)
+  {
+  }
+
+  // Adopts the array owned by `u`; the caller supplies the length `u` does not know.
+  template<
+      class E, typename std::enable_if<std::is_constructible<Deleter, E&&>::value && !std::is_reference<E>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX14_CONSTEXPR unique_array(unique_ptr<T[], E>&& u, size_type n) noexcept(std::is_nothrow_constructible<Deleter, E&&>::value)
+      : deleter_base(std::move(u.get_deleter())), ptr_(u.release()), size_(n)
+  {
+  }
+
+  YK_POLYFILL_CXX14_CONSTEXPR unique_array(unique_array&& other) noexcept
+      : deleter_base(std::move(other.get_deleter())), ptr_(polyfill::exchange(other.ptr_, nullptr)), size_(polyfill::exchange(other.size_, 0))
+  {
+  }
+
+  unique_array(unique_array const&) = delete;
+  unique_array& operator=(unique_array const&) = delete;
+
+  YK_POLYFILL_CXX20_CONSTEXPR ~unique_array() noexcept
+  {
+    if (ptr_) {
+      detail::invoke_deleter(get_deleter(), ptr_, size_);
+    }
+  }
+
+  YK_POLYFILL_CXX20_CONSTEXPR unique_array& operator=(unique_array&& other) noexcept
+  {
+    size_type const n = other.size_;
+    reset(other.release(), n);
+    get_deleter() = std::move(other.get_deleter());
+    return *this;
+  }
+
+  YK_POLYFILL_CXX20_CONSTEXPR unique_array& operator=(std::nullptr_t) noexcept
+  {
+    reset();
+    return *this;
+  }
+
+  // Element access
+
+  YK_POLYFILL_CXX14_CONSTEXPR reference operator[](size_type i) const noexcept { return ptr_[i]; }
+  YK_POLYFILL_CXX14_CONSTEXPR reference front() const noexcept { return ptr_[0]; }
+  YK_POLYFILL_CXX14_CONSTEXPR reference back() const noexcept { return ptr_[size_ - 1]; }
+
+  constexpr pointer data() const noexcept { return ptr_; }
+  constexpr pointer get() const noexcept { return ptr_; }
+
+  constexpr size_type size() const noexcept { return size_; }
+  constexpr size_type size_bytes() const noexcept { return size_ * sizeof(T); }
+  YK_POLYFILL_NODISCARD constexpr bool empty() const noexcept { return size_ == 0; }
+
+  constexpr explicit operator bool() const noexcept { return ptr_ != nullptr; }
+
+  constexpr deleter_type const& get_deleter() const noexcept { return deleter_base::stored_value(); }
+  YK_POLYFILL_CXX14_CONSTEXPR deleter_type& get_deleter() noexcept { return deleter_base::stored_value(); }
+
+  // Iterators
+
+  constexpr iterator begin() const noexcept { return ptr_; }
+  constexpr iterator end() const noexcept { return ptr_ + size_; }
+
+  YK_POLYFILL_CXX17_CONSTEXPR reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+  YK_POLYFILL_CXX17_CONSTEXPR reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+
+#if __cpp_lib_span >= 202002L
+  constexpr std::span<T> as_span() const noexcept { return std::span<T>(ptr_, size_); }
+  constexpr operator std::span<T>() const noexcept { return as_span(); }
+#endif
+
+  // Modifiers
+
+  // Gives up ownership; the caller becomes responsible for the `size()` elements at the returned pointer.
+  YK_POLYFILL_CXX14_CONSTEXPR pointer release() noexcept
+  {
+    size_ = 0;
+    return polyfill::exchange(ptr_, nullptr);
+  }
+
+  YK_POLYFILL_CXX20_CONSTEXPR void reset(pointer p, size_type n) noexcept
+  {
+    pointer const old = polyfill::exchange(ptr_, p);
+    size_type const old_size = polyfill::exchange(size_, n);
+    if (old) {
+      detail::invoke_deleter(get_deleter(), old, old_size);
+    }
+  }
+
+  YK_POLYFILL_CXX20_CONSTEXPR void reset(std::nullptr_t = nullptr) noexcept { reset(pointer(), 0); }
+
+  YK_POLYFILL_CXX14_CONSTEXPR void swap(unique_array& other) noexcept(is_nothrow_swappable<Deleter>::value)
+  {
+    polyfill::detail::constexpr_swap(ptr_, other.ptr_);
+    polyfill::detail::constexpr_swap(size_, other.size_);
+    polyfill::detail::constexpr_swap(deleter_base::stored_value(), other.deleter_base::stored_value());
+  }
+
+private:
+  pointer ptr_;
+  size_type size_;
+};
+
+template<class T, class D>
+YK_POLYFILL_CXX14_CONSTEXPR void swap(unique_array<T, D>& x, unique_array<T, D>& y) noexcept(noexcept(x.swap(y)))
+{
+  x.swap(y);
+}
+
+template<class T, class D>
+constexpr bool operator==(unique_array<T, D> const& x, std::nullptr_t) noexcept
+{
+  return !x;
+}
+
+template<class T, class D>
+constexpr bool operator==(std::nullptr_t, unique_array<T, D> const& x) noexcept
+{
+  return !x;
+}
+
+template<class T, class D>
+constexpr bool operator!=(unique_array<T, D> const& x, std::nullptr_t) noexcept
+{
+  return static_cast<bool>(x);
+}
+
+template<class T, class D>
+constexpr bool operator!=(std::nullptr_t, unique_array<T, D> const& x) noexcept
+{
+  return static_cast<bool>(x);
+}
+
+// make_unique_array: value-initialized elements (`new T[n]()`)
+
+template<class T>
+YK_POLYFILL_NODISCARD YK_POLYFILL_CXX20_CONSTEXPR unique_array<T> make_unique_array(std::size_t n)
+{
+  return unique_array<T>(new T[n](), n);
+}
+
+// make_unique_array_for_overwrite: default-initialized elements (`new T[n]`); trivial `T` is left uninitialized
+
+template<class T>
+YK_POLYFILL_NODISCARD YK_POLYFILL_CXX20_CONSTEXPR unique_array<T> make_unique_array_for_overwrite(std::size_t n)
+{
+  return unique_array<T>(new T[n], n);
+}
+
+}  // namespace extension
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+#endif  // YK_ZZ_POLYFILL_EXTENSION_UNIQUE_ARRAY_HPP
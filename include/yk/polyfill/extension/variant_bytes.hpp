@@ -0,0 +1,128 @@
+#ifndef YK_ZZ_POLYFILL_EXTENSION_VARIANT_BYTES_HPP
+#define YK_ZZ_POLYFILL_EXTENSION_VARIANT_BYTES_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <yk/polyfill/bits/core_traits.hpp>
+
+#include <yk/polyfill/bit.hpp>
+#include <yk/polyfill/optional.hpp>
+#include <yk/polyfill/type_traits.hpp>
+#include <yk/polyfill/variant.hpp>
+
+#include <array>
+#include <memory>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstring>
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+// Byte snapshots of variants whose alternatives are all trivially copyable.
+//
+// Such a variant is itself trivially copyable and never valueless, so its object representation (union bytes plus
+// index) fully describes it: it may be memcpy'd or bit_cast as a whole, arrays of it included. The representation is
+// that of the current compiler/ABI (index width, padding and byte order are not normalized), so snapshots are for
+// shared memory and files read back by the same build. from_bytes only accepts snapshots whose stored index names an
+// alternative; the bytes of the alternative itself are taken as-is.
+
+template<class V>
+struct is_byte_copyable_variant : false_type {};
+
+template<class... Ts>
+struct is_byte_copyable_variant<variant<Ts...>> : conjunction<std::is_trivially_copyable<Ts>...> {};
+
+template<class V>
+struct is_byte_copyable_variant<V const> : is_byte_copyable_variant<V> {};
+
+template<class V>
+using variant_byte_array = std::array<unsigned char, sizeof(V)>;
+
+namespace detail {
+
+// Materializes the snapshot at `src` as a real V object (bit_cast, not a cast of the buffer's address, which names no
+// V object before C++20's implicit object creation).
+template<class V>
+V load_snapshot(unsigned char const* src) noexcept
+{
+  variant_byte_array<V> bytes;
+  std::memcpy(bytes.data(), src, sizeof(V));
+  return polyfill::bit_cast<V>(bytes);
+}
+
+// Reads the stored index of the snapshot at `src`. Everything but the index bytes is dead, so this compiles to a
+// single narrow load.
+template<class V>
+std::size_t stored_index(unsigned char const* src) noexcept
+{
+  return detail::load_snapshot<V>(src).index();
+}
+
+}  // namespace detail
+
+// to_bytes
+
+template<class... Ts, typename std::enable_if<is_byte_copyable_variant<variant<Ts...>>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_CXX20_CONSTEXPR variant_byte_array<variant<Ts...>> to_bytes(variant<Ts...> const& v) noexcept
+{
+  return polyfill::bit_cast<variant_byte_array<variant<Ts...>>>(v);
+}
+
+// writes sizeof(v) bytes to `dest`
+template<class... Ts, typename std::enable_if<is_byte_copyable_variant<variant<Ts...>>::value, std::nullptr_t>::type = nullptr>
+void to_bytes(variant<Ts...> const& v, void* dest) noexcept
+{
+  std::memcpy(dest, std::addressof(v), sizeof(v));
+}
+
+// writes `count` consecutive snapshots (count * sizeof(variant) bytes) with a single memcpy
+template<class... Ts, typename std::enable_if<is_byte_copyable_variant<variant<Ts...>>::value, std::nullptr_t>::type = nullptr>
+void to_bytes(variant<Ts...> const* first, std::size_t count, void* dest) noexcept
+{
+  if (count != 0) std::memcpy(dest, first, count * sizeof(variant<Ts...>));
+}
+
+// from_bytes
+
+// nullopt if `size` is not sizeof(V) or the stored index is out of range
+template<class V, typename std::enable_if<is_byte_copyable_variant<V>::value, std::nullptr_t>::type = nullptr>
+optional<V> from_bytes(void const* src, std::size_t size) noexcept
+{
+  if (size != sizeof(V)) return nullopt;
+  V const v = detail::load_snapshot<typename std::remove_cv<V>::type>(static_cast<unsigned char const*>(src));
+  if (v.index() >= variant_size<V>::value) return nullopt;
+  return optional<V>(v);
+}
+
+template<class V, typename std::enable_if<is_byte_copyable_variant<V>::value, std::nullptr_t>::type = nullptr>
+optional<V> from_bytes(variant_byte_array<V> const& bytes) noexcept
+{
+  return extension::from_bytes<V>(bytes.data(), bytes.size());
+}
+
+// Validates all `count` snapshots at `src`, then copies them into `out` with a single memcpy.
+// Returns false and leaves `out` untouched if any stored index is out of range.
+template<class... Ts, typename std::enable_if<is_byte_copyable_variant<variant<Ts...>>::value, std::nullptr_t>::type = nullptr>
+bool from_bytes(void const* src, std::size_t count, variant<Ts...>* out) noexcept
+{
+  using V = variant<Ts...>;
+  unsigned char const* p = static_cast<unsigned char const*>(src);
+  for (std::size_t i = 0; i != count; ++i) {
+    if (detail::stored_index<V>(p + i * sizeof(V)) >= sizeof...(Ts)) return false;
+  }
+  if (count != 0) std::memcpy(out, src, count * sizeof(V));
+  return true;
+}
+
+}  // namespace extension
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+#endif  // YK_ZZ_POLYFILL_EXTENSION_VARIANT_BYTES_HPP
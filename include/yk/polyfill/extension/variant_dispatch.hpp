@@ -0,0 +1,133 @@
+#ifndef YK_ZZ_POLYFILL_EXTENSION_VARIANT_DISPATCH_HPP
+#define YK_ZZ_POLYFILL_EXTENSION_VARIANT_DISPATCH_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <yk/polyfill/bits/core_traits.hpp>
+
+#include <yk/polyfill/functional.hpp>
+#include <yk/polyfill/type_traits.hpp>
+#include <yk/polyfill/utility.hpp>
+#include <yk/polyfill/variant.hpp>
+
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+// visit_index(v, f): calls f(integral_constant<std::size_t, I>{}) for the active index I, without touching the value.
+// Goes through variant's own raw_visit dispatch; throws bad_variant_access if v is valueless.
+
+namespace detail {
+
+template<class R, class F>
+struct visit_index_adaptor {
+  F&& f;
+
+  template<std::size_t I, class UnionOrValue>
+  constexpr R operator()(in_place_index_t<I>, UnionOrValue&&) const
+  {
+    return polyfill::invoke_r<R>(std::forward<F>(f), integral_constant<std::size_t, I>{});
+  }
+
+  template<class UnionT>
+  R operator()(in_place_index_t<variant_npos>, UnionT&&) const
+  {
+    throw bad_variant_access{};
+  }
+};
+
+}  // namespace detail
+
+template<
+    class V, class F, typename std::enable_if<polyfill::detail::is_variant<typename remove_cvref<V>::type>::value, std::nullptr_t>::type = nullptr,
+    class R = typename invoke_result<F, integral_constant<std::size_t, 0>>::type>
+YK_POLYFILL_CXX14_CONSTEXPR R visit_index(V&& v, F&& f)
+{
+  return v.raw_visit(detail::visit_index_adaptor<R, F>{std::forward<F>(f)});
+}
+
+// match_if<Us...>(v, f, otherwise): tests the listed alternatives in order with plain index compares and calls
+// f(get<U>(v)) for the first one that is active; otherwise(v) handles everything else, including valueless.
+// The first listed alternative is hinted as likely, so "fast path for the common case, generic fallback" needs no table.
+// Results are converted to the result type of otherwise(v).
+
+namespace detail {
+
+template<class U, class V>
+struct alternative_index;
+
+template<class U, class... Ts>
+struct alternative_index<U, variant<Ts...>> : polyfill::detail::find_index<U, Ts...> {};
+
+template<class U, class V>
+struct is_unique_alternative_of;
+
+template<class U, class... Ts>
+struct is_unique_alternative_of<U, variant<Ts...>> : polyfill::detail::exactly_once<U, Ts...> {};
+
+template<bool First, class... Us>
+struct match_if_impl;
+
+template<bool First>
+struct match_if_impl<First> {
+  template<class R, class V, class F, class Otherwise>
+  static constexpr R apply(V&& v, F&&, Otherwise&& otherwise)
+  {
+    return polyfill::invoke_r<R>(std::forward<Otherwise>(otherwise), std::forward<V>(v));
+  }
+};
+
+template<class U, class... Us>
+struct match_if_impl</* First = */ true, U, Us...> {
+  template<class R, class V, class F, class Otherwise, class Variant = typename remove_cvref<V>::type>
+  static constexpr R apply(V&& v, F&& f, Otherwise&& otherwise)
+  {
+    return YK_POLYFILL_LIKELY(v.index() == alternative_index<U, Variant>::value)
+               ? polyfill::invoke_r<R>(
+                     std::forward<F>(f),
+                     polyfill::detail::raw_get<alternative_index<U, Variant>::value>(polyfill::detail::variant_access::vunion(std::forward<V>(v)))
+                 )
+               : match_if_impl<false, Us...>::template apply<R>(std::forward<V>(v), std::forward<F>(f), std::forward<Otherwise>(otherwise));
+  }
+};
+
+template<class U, class... Us>
+struct match_if_impl</* First = */ false, U, Us...> {
+  template<class R, class V, class F, class Otherwise, class Variant = typename remove_cvref<V>::type>
+  static constexpr R apply(V&& v, F&& f, Otherwise&& otherwise)
+  {
+    return v.index() == alternative_index<U, Variant>::value
+               ? polyfill::invoke_r<R>(
+                     std::forward<F>(f),
+                     polyfill::detail::raw_get<alternative_index<U, Variant>::value>(polyfill::detail::variant_access::vunion(std::forward<V>(v)))
+                 )
+               : match_if_impl<false, Us...>::template apply<R>(std::forward<V>(v), std::forward<F>(f), std::forward<Otherwise>(otherwise));
+  }
+};
+
+}  // namespace detail
+
+template<
+    class... Us, class V, class F, class Otherwise,
+    typename std::enable_if<polyfill::detail::is_variant<typename remove_cvref<V>::type>::value, std::nullptr_t>::type = nullptr,
+    class R = typename invoke_result<Otherwise, V>::type>
+YK_POLYFILL_CXX14_CONSTEXPR R match_if(V&& v, F&& f, Otherwise&& otherwise)
+{
+  static_assert(conjunction<detail::is_unique_alternative_of<Us, typename remove_cvref<V>::type>...>::value, "each of Us... must occur exactly once in the variant's alternatives");
+  return detail::match_if_impl<true, Us...>::template apply<R>(std::forward<V>(v), std::forward<F>(f), std::forward<Otherwise>(otherwise));
+}
+
+}  // namespace extension
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+#endif  // YK_ZZ_POLYFILL_EXTENSION_VARIANT_DISPATCH_HPP
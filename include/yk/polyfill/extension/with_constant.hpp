@@ -0,0 +1,76 @@
+#ifndef YK_ZZ_POLYFILL_EXTENSION_WITH_CONSTANT_HPP
+#define YK_ZZ_POLYFILL_EXTENSION_WITH_CONSTANT_HPP
+
+#include <yk/polyfill/config.hpp>
+
+#include <yk/polyfill/bits/core_traits.hpp>
+
+#include <yk/polyfill/extension/dispatch_index.hpp>
+
+#include <yk/polyfill/functional.hpp>
+#include <yk/polyfill/type_traits.hpp>
+#include <yk/polyfill/utility.hpp>
+
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+// assume all C++20 features available
+#if __cplusplus >= 202002L
+
+// is_constant_wrapper<T>: T (ignoring cv/ref) is a constant_wrapper specialization.
+// Kernels taking `auto stride` work unchanged with both a runtime int and cw<4>; this trait lets them branch on which.
+template<class T>
+struct is_constant_wrapper : polyfill::detail::is_specialization_of_constant_wrapper<typename remove_cvref<T>::type> {};
+
+template<class T>
+inline constexpr bool is_constant_wrapper_v = is_constant_wrapper<T>::value;
+
+// with_constant<Max>(v, f): calls f(cw<T(I)>) for I == v, turning a runtime value into a compile-time one.
+// T may be any integral or enumeration type; the valid range is [0, Max) and anything outside throws std::out_of_range.
+// Dispatch goes through dispatch_index<Max>, i.e. a single indexed call through a table of Max function pointers.
+// Every result is converted to the result type of f(cw<T(0)>).
+//
+//   with_constant<5>(width, [&](auto w) { return kernel<w>(data); });
+
+namespace detail {
+
+template<class T, class F>
+struct with_constant_adaptor {
+  F&& f;
+
+  template<std::size_t I>
+  YK_POLYFILL_ALWAYS_INLINE constexpr decltype(auto) operator()(integral_constant<std::size_t, I>) const
+  {
+    return polyfill::invoke(std::forward<F>(f), constant_wrapper<static_cast<T>(I)>{});
+  }
+};
+
+}  // namespace detail
+
+template<
+    std::size_t Max, class T, class F, typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, std::nullptr_t>::type = nullptr,
+    class R = typename invoke_result<F, constant_wrapper<static_cast<T>(0)>>::type>
+constexpr R with_constant(T v, F&& f)
+{
+  static_assert(Max > 0, "with_constant needs a non-empty range");
+  // negative values wrap around and fail the range check
+  return extension::dispatch_index<Max>(static_cast<std::size_t>(v), detail::with_constant_adaptor<T, F>{std::forward<F>(f)});
+}
+
+#endif
+
+}  // namespace extension
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+#endif  // YK_ZZ_POLYFILL_EXTENSION_WITH_CONSTANT_HPP
@@ -1,6 +1,7 @@
 #ifndef YK_ZZ_POLYFILL_FUNCTIONAL_HPP
 #define YK_ZZ_POLYFILL_FUNCTIONAL_HPP
 
+#include <yk/polyfill/bits/bind.hpp>
 #include <yk/polyfill/bits/function_wrapper.hpp>
 #include <yk/polyfill/bits/invoke.hpp>
 
@@ -8,6 +8,7 @@
 #include <yk/polyfill/bits/allocator_is_always_equal.hpp>
 #include <yk/polyfill/bits/swap.hpp>
 #include <yk/polyfill/extension/ebo_storage.hpp>
+#include <yk/polyfill/extension/is_trivially_relocatable.hpp>
 #include <yk/polyfill/utility.hpp>
 
 #include <functional>
@@ -529,6 +530,14 @@ struct indirect_hash<T, A, void_t<decltype(std::hash<T>{}(std::declval<T const&>
 
 }  // namespace detail
 
+namespace extension {
+
+// owns its value through a pointer, so it relocates whenever the allocator does
+template<class T, class A>
+struct is_trivially_relocatable<indirect<T, A>> : is_trivially_relocatable<A> {};
+
+}  // namespace extension
+
 }  // namespace polyfill
 
 }  // namespace yk
@@ -6,6 +6,7 @@
 #include <yk/polyfill/bits/swap.hpp>
 #include <yk/polyfill/bits/core_traits.hpp>
 #include <yk/polyfill/extension/ebo_storage.hpp>
+#include <yk/polyfill/extension/is_trivially_relocatable.hpp>
 #include <yk/polyfill/type_traits.hpp>
 
 #include <functional>
@@ -543,6 +544,13 @@ YK_POLYFILL_CXX14_CONSTEXPR void swap(unique_ptr<T, D>& x, unique_ptr<T, D>& y)
   x.swap(y);
 }
 
+namespace extension {
+
+template<class T, class D>
+struct is_trivially_relocatable<unique_ptr<T, D>> : conjunction<is_trivially_relocatable<typename unique_ptr<T, D>::pointer>, is_trivially_relocatable<D>> {};
+
+}  // namespace extension
+
 // make_unique
 
 template<class T, class... Args, class = typename std::enable_if<!std::is_array<T>::value>::type>
@@ -560,6 +568,23 @@ YK_POLYFILL_NODISCARD YK_POLYFILL_CXX20_CONSTEXPR unique_ptr<T> make_unique(std:
 template<class T, class... Args, class = typename std::enable_if<is_bounded_array<T>::value>::type>
 void make_unique(Args&&...) = delete;
 
+// make_unique_for_overwrite: default-initializes, so trivial types are left uninitialized
+
+template<class T, class = typename std::enable_if<!std::is_array<T>::value>::type>
+YK_POLYFILL_NODISCARD YK_POLYFILL_CXX20_CONSTEXPR unique_ptr<T> make_unique_for_overwrite()
+{
+  return unique_ptr<T>(new T);
+}
+
+template<class T, class = typename std::enable_if<is_unbounded_array<T>::value>::type>
+YK_POLYFILL_NODISCARD YK_POLYFILL_CXX20_CONSTEXPR unique_ptr<T> make_unique_for_overwrite(std::size_t size)
+{
+  return unique_ptr<T>(new typename std::remove_extent<T>::type[size]);
+}
+
+template<class T, class... Args, class = typename std::enable_if<is_bounded_array<T>::value>::type>
+void make_unique_for_overwrite(Args&&...) = delete;
+
 namespace detail {
 
 template<class T, class D, class = void>
@@ -3,6 +3,7 @@
 
 #include <yk/polyfill/bits/cond_trivial_smf.hpp>
 #include <yk/polyfill/bits/core_traits.hpp>
+#include <yk/polyfill/bits/hash_mix.hpp>
 
 #include <yk/polyfill/extension/specialization_of.hpp>
 
@@ -14,6 +15,7 @@
 
 #include <yk/polyfill/config.hpp>
 
+#include <functional>
 #include <initializer_list>
 #include <memory>
 #include <type_traits>
@@ -682,7 +684,8 @@ public:
   template<
       class U, typename std::enable_if<
                    !std::is_same<typename remove_cvref<U>::type, optional>::value && !std::is_same<typename remove_cvref<U>::type, in_place_t>::value
-                       && std::is_constructible<T&, U>::value && std::is_convertible<U, T&>::value,
+                       && std::is_constructible<T&, U>::value && std::is_convertible<U, T&>::value
+                       && !detail::reference_constructs_from_temporary<T&, U>::value,
                    std::nullptr_t>::type = nullptr>
   YK_POLYFILL_CXX17_CONSTEXPR optional(U&& u) noexcept(std::is_nothrow_constructible<T&, U>::value)
   {
@@ -692,13 +695,22 @@ public:
   template<
       class U, typename std::enable_if<
                    !std::is_same<typename remove_cvref<U>::type, optional>::value && !std::is_same<typename remove_cvref<U>::type, in_place_t>::value
-                       && std::is_constructible<T&, U>::value && !std::is_convertible<U, T&>::value,
+                       && std::is_constructible<T&, U>::value && !std::is_convertible<U, T&>::value
+                       && !detail::reference_constructs_from_temporary<T&, U>::value,
                    std::nullptr_t>::type = nullptr>
   YK_POLYFILL_CXX17_CONSTEXPR explicit optional(U&& u) noexcept(std::is_nothrow_constructible<T&, U>::value)
   {
     convert_ref_init_val(std::forward<U>(u));
   }
 
+  // binding to a temporary would dangle as soon as the full-expression ends
+  template<
+      class U, typename std::enable_if<
+                   !std::is_same<typename remove_cvref<U>::type, optional>::value && !std::is_same<typename remove_cvref<U>::type, in_place_t>::value
+                       && std::is_constructible<T&, U>::value && detail::reference_constructs_from_temporary<T&, U>::value,
+                   std::nullptr_t>::type = nullptr>
+  optional(U&& u) = delete;
+
   template<
       class U, typename std::enable_if<
                    !std::is_same<typename std::remove_cv<T>::type, optional<U>>::value && !std::is_same<T&, U>::value && std::is_constructible<T&, U&>::value
@@ -796,13 +808,18 @@ public:
     return **this;
   }
 
-  YK_POLYFILL_CXX17_CONSTEXPR void swap(optional& rhs) noexcept { std::swap(ptr, rhs.ptr); }
+  YK_POLYFILL_CXX14_CONSTEXPR void swap(optional& rhs) noexcept
+  {
+    T* tmp = ptr;
+    ptr = rhs.ptr;
+    rhs.ptr = tmp;
+  }
 
   constexpr T* operator->() const noexcept { return ptr; };
 
   constexpr T& operator*() const noexcept { return *ptr; }
 
-  constexpr operator bool() const noexcept { return ptr != nullptr; }
+  constexpr explicit operator bool() const noexcept { return ptr != nullptr; }
 
   constexpr bool has_value() const noexcept { return ptr != nullptr; }
 
@@ -872,14 +889,12 @@ public:
     }
   }
 
+  // optional<T&> is a view: constness is shallow, so there is a single iterator type
   using iterator = detail::optional_iterator<T, false>;
-  using const_iterator = detail::optional_iterator<T, true>;
-
-  YK_POLYFILL_CXX14_CONSTEXPR iterator begin() noexcept { return iterator{operator->() + !has_value()}; }
-  constexpr const_iterator begin() const noexcept { return const_iterator{operator->() + !has_value()}; }
+  using const_iterator = iterator;
 
-  YK_POLYFILL_CXX14_CONSTEXPR iterator end() noexcept { return begin() + has_value(); }
-  constexpr const_iterator end() const noexcept { return begin() + has_value(); }
+  constexpr iterator begin() const noexcept { return iterator{ptr}; }
+  constexpr iterator end() const noexcept { return iterator{ptr + has_value()}; }
 
 private:
   template<class U>
@@ -1206,8 +1221,32 @@ constexpr optional<T> make_optional(std::initializer_list<U> il, Args&&... args)
   return optional<T>(in_place, il, std::forward<Args>(args)...);
 }
 
+namespace detail {
+
+// An engaged optional hashes like its value (as std::optional does); a disengaged one hashes to a fixed constant.
+template<class T, class = void>
+struct optional_hash {};
+
+template<class T>
+struct optional_hash<T, void_t<decltype(std::hash<typename std::remove_const<T>::type>{}(std::declval<T const&>()))>> {
+  std::size_t operator()(optional<T> const& opt) const noexcept(noexcept(std::hash<typename std::remove_const<T>::type>{}(*opt)))
+  {
+    return opt.has_value() ? std::hash<typename std::remove_const<T>::type>{}(*opt) : detail::hash_disengaged;
+  }
+};
+
+}  // namespace detail
+
 }  // namespace polyfill
 
 }  // namespace yk
 
+// Hash specialization
+namespace std {
+
+template<class T>
+struct hash<yk::polyfill::optional<T>> : yk::polyfill::detail::optional_hash<T> {};
+
+}  // namespace std
+
 #endif  // YK_ZZ_POLYFILL_OPTIONAL_HPP
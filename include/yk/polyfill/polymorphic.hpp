@@ -7,6 +7,7 @@
 
 #include <yk/polyfill/config.hpp>
 #include <yk/polyfill/extension/ebo_storage.hpp>
+#include <yk/polyfill/extension/is_trivially_relocatable.hpp>
 #include <yk/polyfill/bits/allocator_is_always_equal.hpp>
 #include <yk/polyfill/bits/swap.hpp>
 #include <yk/polyfill/utility.hpp>
@@ -391,6 +392,14 @@ struct polymorphic_move_ctor_ops</*AlwaysEqual = */ false> {
 
 }  // namespace detail
 
+namespace extension {
+
+// only the holder pointer and the allocator live in the object itself
+template<class T, class A>
+struct is_trivially_relocatable<polymorphic<T, A>> : is_trivially_relocatable<A> {};
+
+}  // namespace extension
+
 }  // namespace polyfill
 
 }  // namespace yk
@@ -1,24 +1,473 @@
 #ifndef YK_ZZ_POLYFILL_TUPLE_HPP
 #define YK_ZZ_POLYFILL_TUPLE_HPP
 
+#include <yk/polyfill/config.hpp>
+
 #include <yk/polyfill/bits/apply.hpp>
+#include <yk/polyfill/bits/core_traits.hpp>
+#include <yk/polyfill/bits/swap.hpp>
+#include <yk/polyfill/bits/tuple_leaf.hpp>
+
+#include <yk/polyfill/extension/pack_indexing.hpp>
 
 #include <yk/polyfill/type_traits.hpp>
+#include <yk/polyfill/utility.hpp>
+
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
 
 namespace yk {
 
 namespace polyfill {
 
+// tuple<Ts...>: a flat tuple. Every element lives in its own tuple_leaf<I, T> base, all generated by one
+// index_sequence expansion, so get<I> / get<T> and tuple_element cost no recursive instantiation.
+// Elements are copy/move assigned memberwise; reference elements assign through to the objects they refer to.
+// A tuple of references (such as a soa_vector row) can also be assigned and swapped through a const or prvalue tuple.
+
+namespace detail {
+
+template<class Is, class... Ts>
+struct tuple_storage;
+
+template<std::size_t... Is, class... Ts>
+struct YK_POLYFILL_EMPTY_BASES tuple_storage<index_sequence<Is...>, Ts...> : tuple_leaf<Is, Ts>... {
+  constexpr tuple_storage() : tuple_leaf<Is, Ts>()... {}
+
+  template<class... Us>
+  constexpr explicit tuple_storage(in_place_t, Us&&... us) : tuple_leaf<Is, Ts>(std::forward<Us>(us))...
+  {
+  }
+
+  template<class... Us>
+  constexpr explicit tuple_storage(tuple_storage<index_sequence<Is...>, Us...> const& other) : tuple_leaf<Is, Ts>(get_leaf<Is>(other))...
+  {
+  }
+
+  template<class... Us>
+  constexpr explicit tuple_storage(tuple_storage<index_sequence<Is...>, Us...>&& other) : tuple_leaf<Is, Ts>(std::forward<Us>(get_leaf<Is>(other)))...
+  {
+  }
+};
+
+template<bool SameSize, class Tuple, class... Us>
+struct is_tuple_converting_constructible_impl : false_type {};
+
+template<class... Ts, class... Us>
+struct is_tuple_converting_constructible_impl</* SameSize = */ true, tuple<Ts...>, Us...> : conjunction<std::is_constructible<Ts, Us>...> {};
+
+// sizeof...(Us) == tuple_size<Tuple> and each element is constructible from the corresponding U
+template<class Tuple, class... Us>
+struct is_tuple_converting_constructible;
+
+template<class... Ts, class... Us>
+struct is_tuple_converting_constructible<tuple<Ts...>, Us...>
+    : is_tuple_converting_constructible_impl<sizeof...(Ts) == sizeof...(Us), tuple<Ts...>, Us...> {};
+
+template<class... Ts>
+struct is_tuple_swappable : conjunction<is_swappable<Ts>...> {};
+
+template<class... Ts>
+struct is_tuple_nothrow_swappable : conjunction<is_nothrow_swappable<Ts>...> {};
+
+template<bool SameSize, class Tuple, class... Us>
+struct is_tuple_assignable_impl : false_type {};
+
+template<class... Ts, class... Us>
+struct is_tuple_assignable_impl</* SameSize = */ true, tuple<Ts...>, Us...> : conjunction<std::is_assignable<Ts&, Us>...> {};
+
+// sizeof...(Us) == tuple_size<Tuple> and each element of a (possibly const) Tuple is assignable from the corresponding U
+template<class Tuple, class... Us>
+struct is_tuple_assignable;
+
+template<class... Ts, class... Us>
+struct is_tuple_assignable<tuple<Ts...>, Us...> : is_tuple_assignable_impl<sizeof...(Ts) == sizeof...(Us), tuple<Ts...>, Us...> {};
+
+template<class... Ts, class... Us>
+struct is_tuple_assignable<tuple<Ts...> const, Us...> : is_tuple_assignable_impl<sizeof...(Ts) == sizeof...(Us), tuple<Ts const...>, Us...> {};
+
+struct tuple_access;
+
+}  // namespace detail
+
+template<class... Ts>
+class tuple : private detail::tuple_storage<index_sequence_for<Ts...>, Ts...> {
+  using storage_type = detail::tuple_storage<index_sequence_for<Ts...>, Ts...>;
+
+  template<class... Us>
+  friend class tuple;
+
+  friend struct detail::tuple_access;
+
+public:
+  template<
+      class Dummy = void,
+      typename std::enable_if<conjunction<std::is_void<Dummy>, std::is_default_constructible<Ts>...>::value, std::nullptr_t>::type = nullptr>
+  constexpr tuple() noexcept(conjunction<std::is_nothrow_default_constructible<Ts>...>::value) : storage_type()
+  {
+  }
+
+  // element-wise
+
+  template<
+      class... Us,
+      typename std::enable_if<
+          sizeof...(Us) == sizeof...(Ts) && sizeof...(Us) != 0 && !conjunction<std::is_same<typename remove_cvref<Us>::type, tuple>...>::value,
+          std::nullptr_t>::type = nullptr,
+      typename std::enable_if<detail::is_tuple_converting_constructible<tuple, Us...>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<conjunction<std::is_convertible<Us, Ts>...>::value, std::nullptr_t>::type = nullptr>
+  constexpr tuple(Us&&... us) noexcept(conjunction<std::is_nothrow_constructible<Ts, Us>...>::value) : storage_type(in_place, std::forward<Us>(us)...)
+  {
+  }
+
+  template<
+      class... Us,
+      typename std::enable_if<
+          sizeof...(Us) == sizeof...(Ts) && sizeof...(Us) != 0 && !conjunction<std::is_same<typename remove_cvref<Us>::type, tuple>...>::value,
+          std::nullptr_t>::type = nullptr,
+      typename std::enable_if<detail::is_tuple_converting_constructible<tuple, Us...>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<!conjunction<std::is_convertible<Us, Ts>...>::value, std::nullptr_t>::type = nullptr>
+  constexpr explicit tuple(Us&&... us) noexcept(conjunction<std::is_nothrow_constructible<Ts, Us>...>::value)
+      : storage_type(in_place, std::forward<Us>(us)...)
+  {
+  }
+
+  // converting from tuple<Us...>
+
+  template<
+      class... Us, typename std::enable_if<!std::is_same<tuple<Us...>, tuple>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<detail::is_tuple_converting_constructible<tuple, Us const&...>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<conjunction<std::is_convertible<Us const&, Ts>...>::value, std::nullptr_t>::type = nullptr>
+  constexpr tuple(tuple<Us...> const& other) noexcept(conjunction<std::is_nothrow_constructible<Ts, Us const&>...>::value) : storage_type(static_cast<typename tuple<Us...>::storage_type const&>(other))
+  {
+  }
+
+  template<
+      class... Us, typename std::enable_if<!std::is_same<tuple<Us...>, tuple>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<detail::is_tuple_converting_constructible<tuple, Us const&...>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<!conjunction<std::is_convertible<Us const&, Ts>...>::value, std::nullptr_t>::type = nullptr>
+  constexpr explicit tuple(tuple<Us...> const& other) noexcept(conjunction<std::is_nothrow_constructible<Ts, Us const&>...>::value)
+      : storage_type(static_cast<typename tuple<Us...>::storage_type const&>(other))
+  {
+  }
+
+  template<
+      class... Us, typename std::enable_if<!std::is_same<tuple<Us...>, tuple>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<detail::is_tuple_converting_constructible<tuple, Us&&...>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<conjunction<std::is_convertible<Us&&, Ts>...>::value, std::nullptr_t>::type = nullptr>
+  constexpr tuple(tuple<Us...>&& other) noexcept(conjunction<std::is_nothrow_constructible<Ts, Us&&>...>::value) : storage_type(static_cast<typename tuple<Us...>::storage_type&&>(other))
+  {
+  }
+
+  template<
+      class... Us, typename std::enable_if<!std::is_same<tuple<Us...>, tuple>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<detail::is_tuple_converting_constructible<tuple, Us&&...>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<!conjunction<std::is_convertible<Us&&, Ts>...>::value, std::nullptr_t>::type = nullptr>
+  constexpr explicit tuple(tuple<Us...>&& other) noexcept(conjunction<std::is_nothrow_constructible<Ts, Us&&>...>::value)
+      : storage_type(static_cast<typename tuple<Us...>::storage_type&&>(other))
+  {
+  }
+
+  // assignment; copy and move assignment from the same tuple type are the implicit memberwise ones
+
+  template<
+      class... Us, typename std::enable_if<!std::is_same<tuple<Us...>, tuple>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<detail::is_tuple_assignable<tuple, Us const&...>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX14_CONSTEXPR tuple& operator=(tuple<Us...> const& other) noexcept(conjunction<std::is_nothrow_assignable<Ts&, Us const&>...>::value)
+  {
+    tuple::assign(static_cast<storage_type&>(*this), static_cast<typename tuple<Us...>::storage_type const&>(other), index_sequence_for<Ts...>{});
+    return *this;
+  }
+
+  template<
+      class... Us, typename std::enable_if<!std::is_same<tuple<Us...>, tuple>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<detail::is_tuple_assignable<tuple, Us&&...>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX14_CONSTEXPR tuple& operator=(tuple<Us...>&& other) noexcept(conjunction<std::is_nothrow_assignable<Ts&, Us&&>...>::value)
+  {
+    tuple::assign(static_cast<storage_type&>(*this), static_cast<typename tuple<Us...>::storage_type&&>(other), index_sequence_for<Ts...>{});
+    return *this;
+  }
+
+  // const-qualified assignment, for tuples of references (e.g. `v[i] = row` with a proxy row)
+
+  template<class Dummy = void, typename std::enable_if<detail::is_tuple_assignable<tuple const, Ts const&...>::value && std::is_void<Dummy>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX14_CONSTEXPR tuple const& operator=(tuple const& other) const noexcept(conjunction<std::is_nothrow_assignable<Ts const&, Ts const&>...>::value)
+  {
+    tuple::assign(static_cast<storage_type const&>(*this), static_cast<storage_type const&>(other), index_sequence_for<Ts...>{});
+    return *this;
+  }
+
+  template<class Dummy = void, typename std::enable_if<detail::is_tuple_assignable<tuple const, Ts&&...>::value && std::is_void<Dummy>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX14_CONSTEXPR tuple const& operator=(tuple&& other) const noexcept(conjunction<std::is_nothrow_assignable<Ts const&, Ts&&>...>::value)
+  {
+    tuple::assign(static_cast<storage_type const&>(*this), static_cast<storage_type&&>(other), index_sequence_for<Ts...>{});
+    return *this;
+  }
+
+  template<
+      class... Us, typename std::enable_if<!std::is_same<tuple<Us...>, tuple>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<detail::is_tuple_assignable<tuple const, Us const&...>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX14_CONSTEXPR tuple const& operator=(tuple<Us...> const& other) const noexcept(conjunction<std::is_nothrow_assignable<Ts const&, Us const&>...>::value)
+  {
+    tuple::assign(static_cast<storage_type const&>(*this), static_cast<typename tuple<Us...>::storage_type const&>(other), index_sequence_for<Ts...>{});
+    return *this;
+  }
+
+  template<
+      class... Us, typename std::enable_if<!std::is_same<tuple<Us...>, tuple>::value, std::nullptr_t>::type = nullptr,
+      typename std::enable_if<detail::is_tuple_assignable<tuple const, Us&&...>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX14_CONSTEXPR tuple const& operator=(tuple<Us...>&& other) const noexcept(conjunction<std::is_nothrow_assignable<Ts const&, Us&&>...>::value)
+  {
+    tuple::assign(static_cast<storage_type const&>(*this), static_cast<typename tuple<Us...>::storage_type&&>(other), index_sequence_for<Ts...>{});
+    return *this;
+  }
+
+  template<class Dummy = void, typename std::enable_if<detail::is_tuple_swappable<Ts...>::value && std::is_void<Dummy>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX14_CONSTEXPR void swap(tuple& other) noexcept(detail::is_tuple_nothrow_swappable<Ts...>::value)
+  {
+    tuple::swap_impl(static_cast<storage_type&>(*this), static_cast<storage_type&>(other), index_sequence_for<Ts...>{});
+  }
+
+  // swaps the referred-to objects of two tuples of references
+  template<class Dummy = void, typename std::enable_if<detail::is_tuple_swappable<Ts const...>::value && std::is_void<Dummy>::value, std::nullptr_t>::type = nullptr>
+  YK_POLYFILL_CXX14_CONSTEXPR void swap(tuple const& other) const noexcept(detail::is_tuple_nothrow_swappable<Ts const...>::value)
+  {
+    tuple::swap_impl(static_cast<storage_type const&>(*this), static_cast<storage_type const&>(other), index_sequence_for<Ts...>{});
+  }
+
+private:
+  template<class Storage, class Other, std::size_t... Is>
+  static YK_POLYFILL_CXX14_CONSTEXPR void assign(Storage& self, Other&& other, index_sequence<Is...>)
+  {
+    using expand = int[];
+    (void)expand{0, (detail::get_leaf<Is>(self) = detail::get_leaf<Is>(std::forward<Other>(other)), 0)...};
+  }
+
+  template<class Storage, std::size_t... Is>
+  static YK_POLYFILL_CXX14_CONSTEXPR void swap_impl(Storage& self, Storage& other, index_sequence<Is...>)
+  {
+    using expand = int[];
+    (void)expand{0, (detail::constexpr_swap(detail::get_leaf<Is>(self), detail::get_leaf<Is>(other)), 0)...};
+  }
+};
+
+namespace detail {
+
+struct tuple_access {
+  template<class... Ts>
+  static YK_POLYFILL_CXX14_CONSTEXPR typename tuple<Ts...>::storage_type& storage(tuple<Ts...>& t) noexcept
+  {
+    return t;
+  }
+
+  template<class... Ts>
+  static constexpr typename tuple<Ts...>::storage_type const& storage(tuple<Ts...> const& t) noexcept
+  {
+    return t;
+  }
+};
+
+}  // namespace detail
+
+// get by index
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename extension::pack_indexing<I, Ts...>::type& get(tuple<Ts...>& t) noexcept
+{
+  static_assert(I < sizeof...(Ts), "I must be in sizeof...(Ts)");
+  return detail::get_leaf<I>(detail::tuple_access::storage(t));
+}
+
+template<std::size_t I, class... Ts>
+constexpr typename extension::pack_indexing<I, Ts...>::type const& get(tuple<Ts...> const& t) noexcept
+{
+  static_assert(I < sizeof...(Ts), "I must be in sizeof...(Ts)");
+  return detail::get_leaf<I>(detail::tuple_access::storage(t));
+}
+
+template<std::size_t I, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR typename extension::pack_indexing<I, Ts...>::type&& get(tuple<Ts...>&& t) noexcept
+{
+  static_assert(I < sizeof...(Ts), "I must be in sizeof...(Ts)");
+  return std::forward<typename extension::pack_indexing<I, Ts...>::type>(detail::get_leaf<I>(detail::tuple_access::storage(t)));
+}
+
+template<std::size_t I, class... Ts>
+constexpr typename extension::pack_indexing<I, Ts...>::type const&& get(tuple<Ts...> const&& t) noexcept
+{
+  static_assert(I < sizeof...(Ts), "I must be in sizeof...(Ts)");
+  return std::forward<typename extension::pack_indexing<I, Ts...>::type const>(detail::get_leaf<I>(detail::tuple_access::storage(t)));
+}
+
+// get by type (T must occur exactly once)
+
+template<class T, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR T& get(tuple<Ts...>& t) noexcept
+{
+  return detail::get_leaf_by_type<T>(detail::tuple_access::storage(t));
+}
+
+template<class T, class... Ts>
+constexpr T const& get(tuple<Ts...> const& t) noexcept
+{
+  return detail::get_leaf_by_type<T>(detail::tuple_access::storage(t));
+}
+
+template<class T, class... Ts>
+YK_POLYFILL_CXX14_CONSTEXPR T&& get(tuple<Ts...>&& t) noexcept
+{
+  return std::forward<T>(detail::get_leaf_by_type<T>(detail::tuple_access::storage(t)));
+}
+
+template<class T, class... Ts>
+constexpr T const&& get(tuple<Ts...> const&& t) noexcept
+{
+  return std::forward<T const>(detail::get_leaf_by_type<T>(detail::tuple_access::storage(t)));
+}
+
+// make_tuple, forward_as_tuple
+
+namespace detail {
+
+template<class T>
+struct unwrap_ref_decay_impl {
+  using type = T;
+};
+
+template<class T>
+struct unwrap_ref_decay_impl<std::reference_wrapper<T>> {
+  using type = T&;
+};
+
+template<class T>
+struct tuple_element_for_make : unwrap_ref_decay_impl<typename std::decay<T>::type> {};
+
+}  // namespace detail
+
+template<class... Us>
+constexpr tuple<typename detail::tuple_element_for_make<Us>::type...> make_tuple(Us&&... us)
+{
+  return tuple<typename detail::tuple_element_for_make<Us>::type...>(std::forward<Us>(us)...);
+}
+
+template<class... Us>
+constexpr tuple<Us&&...> forward_as_tuple(Us&&... us) noexcept
+{
+  return tuple<Us&&...>(std::forward<Us>(us)...);
+}
+
+// comparison operators (lexicographic; stops at the first element that decides)
+
+namespace detail {
+
+template<std::size_t I, std::size_t N>
+struct tuple_compare {
+  template<class... Ts, class... Us>
+  static constexpr bool eq(tuple<Ts...> const& lhs, tuple<Us...> const& rhs)
+  {
+    return polyfill::get<I>(lhs) == polyfill::get<I>(rhs) && tuple_compare<I + 1, N>::eq(lhs, rhs);
+  }
+
+  template<class... Ts, class... Us>
+  static constexpr bool lt(tuple<Ts...> const& lhs, tuple<Us...> const& rhs)
+  {
+    return polyfill::get<I>(lhs) < polyfill::get<I>(rhs) || (!(polyfill::get<I>(rhs) < polyfill::get<I>(lhs)) && tuple_compare<I + 1, N>::lt(lhs, rhs));
+  }
+};
+
+template<std::size_t N>
+struct tuple_compare<N, N> {
+  template<class... Ts, class... Us>
+  static constexpr bool eq(tuple<Ts...> const&, tuple<Us...> const&)
+  {
+    return true;
+  }
+
+  template<class... Ts, class... Us>
+  static constexpr bool lt(tuple<Ts...> const&, tuple<Us...> const&)
+  {
+    return false;
+  }
+};
+
+}  // namespace detail
+
+template<class... Ts, class... Us, typename std::enable_if<sizeof...(Ts) == sizeof...(Us), std::nullptr_t>::type = nullptr>
+constexpr bool operator==(tuple<Ts...> const& lhs, tuple<Us...> const& rhs)
+{
+  return detail::tuple_compare<0, sizeof...(Ts)>::eq(lhs, rhs);
+}
+
+template<class... Ts, class... Us, typename std::enable_if<sizeof...(Ts) == sizeof...(Us), std::nullptr_t>::type = nullptr>
+constexpr bool operator!=(tuple<Ts...> const& lhs, tuple<Us...> const& rhs)
+{
+  return !(lhs == rhs);
+}
+
+template<class... Ts, class... Us, typename std::enable_if<sizeof...(Ts) == sizeof...(Us), std::nullptr_t>::type = nullptr>
+constexpr bool operator<(tuple<Ts...> const& lhs, tuple<Us...> const& rhs)
+{
+  return detail::tuple_compare<0, sizeof...(Ts)>::lt(lhs, rhs);
+}
+
+template<class... Ts, class... Us, typename std::enable_if<sizeof...(Ts) == sizeof...(Us), std::nullptr_t>::type = nullptr>
+constexpr bool operator>(tuple<Ts...> const& lhs, tuple<Us...> const& rhs)
+{
+  return rhs < lhs;
+}
+
+template<class... Ts, class... Us, typename std::enable_if<sizeof...(Ts) == sizeof...(Us), std::nullptr_t>::type = nullptr>
+constexpr bool operator<=(tuple<Ts...> const& lhs, tuple<Us...> const& rhs)
+{
+  return !(rhs < lhs);
+}
+
+template<class... Ts, class... Us, typename std::enable_if<sizeof...(Ts) == sizeof...(Us), std::nullptr_t>::type = nullptr>
+constexpr bool operator>=(tuple<Ts...> const& lhs, tuple<Us...> const& rhs)
+{
+  return !(lhs < rhs);
+}
+
+// swap
+
+template<class... Ts, typename std::enable_if<detail::is_tuple_swappable<Ts...>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_CXX14_CONSTEXPR void swap(tuple<Ts...>& lhs, tuple<Ts...>& rhs) noexcept(noexcept(lhs.swap(rhs)))
+{
+  lhs.swap(rhs);
+}
+
+template<class... Ts, typename std::enable_if<detail::is_tuple_swappable<Ts const...>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_CXX14_CONSTEXPR void swap(tuple<Ts...> const& lhs, tuple<Ts...> const& rhs) noexcept(noexcept(lhs.swap(rhs)))
+{
+  lhs.swap(rhs);
+}
+
+// apply
+
 template<class F, class Tuple>
 constexpr typename apply_result<F, Tuple>::type apply(F&& f, Tuple&& t) noexcept(is_nothrow_applicable<F, Tuple>::value)
 {
-  return detail::apply_guard::apply_impl<make_index_sequence<std::tuple_size<typename std::remove_reference<Tuple>::type>::value>>::apply(
-      static_cast<F&&>(f), static_cast<Tuple&&>(t)
-  );
+  return detail::apply_guard::apply_impl<make_index_sequence<detail::apply_size<Tuple>::value>>::apply(static_cast<F&&>(f), static_cast<Tuple&&>(t));
 }
 
 }  // namespace polyfill
 
 }  // namespace yk
 
+namespace std {
+
+template<class... Ts>
+struct tuple_size<yk::polyfill::tuple<Ts...>> : std::integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template<std::size_t I, class... Ts>
+struct tuple_element<I, yk::polyfill::tuple<Ts...>> {
+  using type = typename yk::polyfill::extension::pack_indexing<I, Ts...>::type;
+};
+
+}  // namespace std
+
 #endif  // YK_ZZ_POLYFILL_TUPLE_HPP
@@ -5,8 +5,10 @@
 
 #include <yk/polyfill/bits/cond_trivial_smf.hpp>
 #include <yk/polyfill/bits/core_traits.hpp>
+#include <yk/polyfill/bits/hash_mix.hpp>
 
 #include <yk/polyfill/extension/is_convertible_without_narrowing.hpp>
+#include <yk/polyfill/extension/is_trivially_relocatable.hpp>
 #include <yk/polyfill/extension/pack_indexing.hpp>
 
 #include <yk/polyfill/functional.hpp>
@@ -15,11 +17,13 @@
 #include <yk/polyfill/utility.hpp>
 
 #include <exception>
+#include <functional>
 #include <memory>
 #include <utility>
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 #if __cplusplus >= 202002L
 #include <compare>
@@ -103,6 +107,54 @@ struct variant_npos_for {
   static constexpr typename select_index<Size>::type value = -1;
 };
 
+#if YK_POLYFILL_CXX_VERSION >= 201402L
+
+// find_index / exactly_once are instantiated for every (T, Ts...) pair by the converting constructor and get<T>.
+// From C++14 on, each lookup is one constexpr scan over an array of is_same results instead of one class template
+// instantiation per alternative.
+
+template<class T, class... Us>
+constexpr std::size_t find_index_pos() noexcept
+{
+  constexpr bool matches[] = {std::is_same<T, Us>::value..., false};
+  std::size_t i = 0;
+  while (i < sizeof...(Us) && !matches[i]) ++i;
+  return i;
+}
+
+template<std::size_t Pos, std::size_t Size>
+struct find_index_result : std::integral_constant<std::size_t, Pos> {};
+
+// not found: no `value`, so find_index stays usable in SFINAE contexts
+template<std::size_t Size>
+struct find_index_result<Size, Size> {};
+
+template<class T, class... Us>
+struct find_index : find_index_result<detail::find_index_pos<T, Us...>(), sizeof...(Us)> {};
+
+#if __cpp_fold_expressions >= 201603L
+
+template<class T, class... Us>
+struct exactly_once : bool_constant<(static_cast<std::size_t>(std::is_same<T, Us>::value) + ... + 0) == 1> {};
+
+#else
+
+template<class T, class... Us>
+constexpr std::size_t count_same() noexcept
+{
+  constexpr bool matches[] = {std::is_same<T, Us>::value..., false};
+  std::size_t n = 0;
+  for (std::size_t i = 0; i < sizeof...(Us); ++i) n += matches[i];
+  return n;
+}
+
+template<class T, class... Us>
+struct exactly_once : bool_constant<detail::count_same<T, Us...>() == 1> {};
+
+#endif
+
+#else  // C++11: no loops in constexpr functions, fall back to recursion
+
 template<std::size_t I, class T, class... Us>
 struct find_index_impl {};
 
@@ -125,6 +177,8 @@ struct exactly_once_impl<true, T, U, Us...> : std::conditional<std::is_same<T, U
 template<class T, class... Us>
 struct exactly_once : exactly_once_impl<false, T, Us...> {};
 
+#endif
+
 struct valueless_t {};
 
 YK_POLYFILL_INLINE constexpr valueless_t valueless{};
@@ -361,6 +415,9 @@ struct raw_visit_dispatch {
 template<class... Ts>
 struct variant_storage;
 
+// grants the comparison operators and extension helpers direct access to the union (see variant_compare)
+struct variant_access;
+
 template<std::size_t I, class Operation>
 struct no_op_wrapper {
   template<class... Args>
@@ -574,11 +631,35 @@ struct emplace_operation</*NeverValueless = */ false> {
   }
 };
 
-template<bool IsDirectConstructionSaferThanMovingTemporary>
+constexpr bool is_constant_evaluated() noexcept
+{
+#if __cpp_lib_is_constant_evaluated >= 201811L
+  return std::is_constant_evaluated();
+#else
+  return false;
+#endif
+}
+
+// How assignment creates a new alternative T_j from Rhs when the index changes.
+//   direct:             destroy the old value, then construct in place (valueless if construction throws)
+//   move_temporary:     construct a temporary first, then destroy the old value and move the temporary in
+//   relocate_temporary: construct a temporary first, then destroy the old value and memcpy the temporary in
+enum class assign_emplacement { direct, move_temporary, relocate_temporary };
+
+template<class T_j, class Rhs>
+constexpr assign_emplacement select_assign_emplacement()
+{
+  return std::is_nothrow_constructible<T_j, Rhs>::value     ? assign_emplacement::direct
+         : extension::is_trivially_relocatable<T_j>::value  ? assign_emplacement::relocate_temporary
+         : std::is_nothrow_move_constructible<T_j>::value   ? assign_emplacement::move_temporary
+                                                            : assign_emplacement::direct;
+}
+
+template<assign_emplacement>
 struct emplace_directly_or_move_temporary_impl;
 
 template<>
-struct emplace_directly_or_move_temporary_impl</*IsDirectConstructionSaferThanMovingTemporary = */ true> {
+struct emplace_directly_or_move_temporary_impl<assign_emplacement::direct> {
   template<std::size_t ValidJ, class... Ts, class Rhs, class T_j = typename extension::pack_indexing<ValidJ, Ts...>::type>
   static YK_POLYFILL_CXX20_CONSTEXPR void apply(variant_storage<Ts...>& lhs, Rhs&& rhs) noexcept(std::is_nothrow_constructible<T_j, Rhs>::value)
   {
@@ -587,7 +668,7 @@ struct emplace_directly_or_move_temporary_impl</*IsDirectConstructionSaferThanMo
 };
 
 template<>
-struct emplace_directly_or_move_temporary_impl</*IsDirectConstructionSaferThanMovingTemporary = */ false> {
+struct emplace_directly_or_move_temporary_impl<assign_emplacement::move_temporary> {
   template<std::size_t ValidJ, class... Ts, class Rhs, class T_j = typename extension::pack_indexing<ValidJ, Ts...>::type>
   static YK_POLYFILL_CXX20_CONSTEXPR void apply(variant_storage<Ts...>& lhs, Rhs&& rhs)
   {
@@ -596,13 +677,28 @@ struct emplace_directly_or_move_temporary_impl</*IsDirectConstructionSaferThanMo
   }
 };
 
+template<>
+struct emplace_directly_or_move_temporary_impl<assign_emplacement::relocate_temporary> {
+  template<std::size_t ValidJ, class... Ts, class Rhs, class T_j = typename extension::pack_indexing<ValidJ, Ts...>::type>
+  static YK_POLYFILL_CXX20_CONSTEXPR void apply(variant_storage<Ts...>& lhs, Rhs&& rhs)
+  {
+    if (detail::is_constant_evaluated()) {
+      emplace_directly_or_move_temporary_impl<assign_emplacement::move_temporary>::template apply<ValidJ>(lhs, std::forward<Rhs>(rhs));
+      return;
+    }
+    alignas(T_j) unsigned char temporary[sizeof(T_j)];
+    polyfill::construct_at(reinterpret_cast<T_j*>(temporary), std::forward<Rhs>(rhs));  // may throw, lhs is untouched
+    lhs.dynamic_reset();
+    std::memcpy(static_cast<void*>(std::addressof(lhs.vunion)), temporary, sizeof(T_j));  // the temporary is not destroyed
+    lhs.vindex = ValidJ;
+  }
+};
+
 struct emplace_directly_or_move_temporary {
   template<std::size_t ValidJ, class... Ts, class Rhs, class T_j = typename extension::pack_indexing<ValidJ, Ts...>::type>
   static YK_POLYFILL_CXX20_CONSTEXPR void apply(variant_storage<Ts...>& lhs_storage, Rhs&& rhs) noexcept(std::is_nothrow_constructible<T_j, Rhs>::value)
   {
-    constexpr bool IsDirectConstructionSaferThanMovingTemporary =
-        disjunction<std::is_nothrow_constructible<T_j, Rhs>, negation<std::is_nothrow_move_constructible<T_j>>>::value;
-    emplace_directly_or_move_temporary_impl<IsDirectConstructionSaferThanMovingTemporary>::template apply<ValidJ>(lhs_storage, std::forward<Rhs>(rhs));
+    emplace_directly_or_move_temporary_impl<detail::select_assign_emplacement<T_j, Rhs>()>::template apply<ValidJ>(lhs_storage, std::forward<Rhs>(rhs));
   }
 };
 
@@ -756,6 +852,17 @@ struct variant_storage {
   {
     std::move(other).raw_visit(move_assign_visitor<Ts...>{*this});
   }
+
+  // Exchanges the whole object representation (union and index) of two storages.
+  // Only valid if every alternative is trivially relocatable.
+  void _relocate_swap(variant_storage& other) noexcept
+  {
+    if (this == std::addressof(other)) return;  // self-swap: memcpy must not see overlapping ranges
+    alignas(variant_storage) unsigned char buf[sizeof(variant_storage)];
+    std::memcpy(buf, static_cast<void const*>(this), sizeof(variant_storage));
+    std::memcpy(static_cast<void*>(this), static_cast<void const*>(std::addressof(other)), sizeof(variant_storage));
+    std::memcpy(static_cast<void*>(std::addressof(other)), buf, sizeof(variant_storage));
+  }
 };
 
 template<bool TriviallyDestructible, class... Ts>
@@ -828,6 +935,9 @@ struct swap_same_index_operation {
   }
 };
 
+template<bool TriviallyRelocatable>
+struct swap_operation;
+
 template<class... Ts>
 struct swap_same_index_visitor {
   variant<Ts...>& other_ref;
@@ -936,17 +1046,14 @@ public:
     return *this;
   }
 
-  YK_POLYFILL_CXX20_CONSTEXPR void swap(variant& other) noexcept(conjunction<std::is_nothrow_move_constructible<Ts>..., is_nothrow_swappable<Ts>...>::value)
+  // Variants whose alternatives are all extension::is_trivially_relocatable are swapped bytewise.
+  YK_POLYFILL_CXX20_CONSTEXPR void swap(variant& other) noexcept(
+      disjunction<
+          conjunction<extension::is_trivially_relocatable<Ts>...>,
+          conjunction<std::is_nothrow_move_constructible<Ts>..., is_nothrow_swappable<Ts>...>>::value
+  )
   {
-    if (index() == other.index()) {
-      if (!valueless_by_exception()) {
-        this->raw_visit(detail::swap_same_index_visitor<Ts...>{other});
-      }
-    } else {
-      variant tmp(std::move(other));
-      other = std::move(*this);
-      *this = std::move(tmp);
-    }
+    detail::swap_operation<conjunction<extension::is_trivially_relocatable<Ts>...>::value>::apply(*this, other);
   }
 
   using base_type::raw_visit;
@@ -962,6 +1069,7 @@ public:
 
   template<std::size_t I, class... Us>
   friend YK_POLYFILL_CXX14_CONSTEXPR typename variant_alternative<I, variant<Us...>>::type const&& get(variant<Us...> const&& v);
+  friend struct detail::variant_access;
 };
 
 template<std::size_t I, class... Ts>
@@ -1130,22 +1238,34 @@ template<std::size_t FlatI, std::size_t K, class... Variants>
 struct multi_visit_index_at
     : integral_constant<std::size_t, (FlatI / multi_visit_stride<K, Variants...>::value) % multi_visit_variant_size_at<K, Variants...>::value> {};
 
-// do_multi_visit: dispatch for a given flat index
-template<class ReturnType, std::size_t FlatI, class IndexSeq, class Visitor, class... Variants>
+// do_multi_visit: dispatch for a given flat index.
+// Convert == false (deduced visit): the result is returned as ReturnType, as plain invoke gives it.
+// Convert == true (visit<R>): each result is converted to ReturnType through invoke_r, or discarded if R is void.
+template<class ReturnType, bool Convert, std::size_t FlatI, class IndexSeq, class Visitor, class... Variants>
 struct do_multi_visit_impl;
 
 template<class ReturnType, std::size_t FlatI, std::size_t... Ks, class Visitor, class... Variants>
-struct do_multi_visit_impl<ReturnType, FlatI, index_sequence<Ks...>, Visitor, Variants...> {
+struct do_multi_visit_impl<ReturnType, false, FlatI, index_sequence<Ks...>, Visitor, Variants...> {
   static YK_POLYFILL_CXX14_CONSTEXPR ReturnType call(Visitor&& vis, Variants&&... vars)
   {
     return polyfill::invoke(std::forward<Visitor>(vis), polyfill::get<multi_visit_index_at<FlatI, Ks, Variants...>::value>(std::forward<Variants>(vars))...);
   }
 };
 
-template<class ReturnType, std::size_t FlatI, class Visitor, class... Variants>
+template<class ReturnType, std::size_t FlatI, std::size_t... Ks, class Visitor, class... Variants>
+struct do_multi_visit_impl<ReturnType, true, FlatI, index_sequence<Ks...>, Visitor, Variants...> {
+  static YK_POLYFILL_CXX14_CONSTEXPR ReturnType call(Visitor&& vis, Variants&&... vars)
+  {
+    return polyfill::invoke_r<ReturnType>(
+        std::forward<Visitor>(vis), polyfill::get<multi_visit_index_at<FlatI, Ks, Variants...>::value>(std::forward<Variants>(vars))...
+    );
+  }
+};
+
+template<class ReturnType, bool Convert, std::size_t FlatI, class Visitor, class... Variants>
 YK_POLYFILL_CXX14_CONSTEXPR ReturnType do_multi_visit(Visitor&& vis, Variants&&... vars)
 {
-  return do_multi_visit_impl<ReturnType, FlatI, index_sequence_for<Variants...>, Visitor, Variants...>::call(
+  return do_multi_visit_impl<ReturnType, Convert, FlatI, index_sequence_for<Variants...>, Visitor, Variants...>::call(
       std::forward<Visitor>(vis), std::forward<Variants>(vars)...
   );
 }
@@ -1155,19 +1275,19 @@ template<class ReturnType, class Visitor, class... Variants>
 using multi_visit_function_type = ReturnType (*)(Visitor&&, Variants&&...);
 
 // visit table
-template<class ReturnType, class Visitor, class IndexSeq, class... Variants>
+template<class ReturnType, bool Convert, class Visitor, class IndexSeq, class... Variants>
 struct multi_visit_table;
 
-template<class ReturnType, class Visitor, std::size_t... FlatIs, class... Variants>
-struct multi_visit_table<ReturnType, Visitor, index_sequence<FlatIs...>, Variants...> {
+template<class ReturnType, bool Convert, class Visitor, std::size_t... FlatIs, class... Variants>
+struct multi_visit_table<ReturnType, Convert, Visitor, index_sequence<FlatIs...>, Variants...> {
   static constexpr multi_visit_function_type<ReturnType, Visitor, Variants...> value[sizeof...(FlatIs)]{
-      &do_multi_visit<ReturnType, FlatIs, Visitor, Variants...>...
+      &do_multi_visit<ReturnType, Convert, FlatIs, Visitor, Variants...>...
   };
 };
 
-template<class ReturnType, class Visitor, std::size_t... FlatIs, class... Variants>
+template<class ReturnType, bool Convert, class Visitor, std::size_t... FlatIs, class... Variants>
 constexpr multi_visit_function_type<ReturnType, Visitor, Variants...>
-    multi_visit_table<ReturnType, Visitor, index_sequence<FlatIs...>, Variants...>::value[sizeof...(FlatIs)];
+    multi_visit_table<ReturnType, Convert, Visitor, index_sequence<FlatIs...>, Variants...>::value[sizeof...(FlatIs)];
 
 // compute runtime flat index
 inline constexpr std::size_t compute_flat_index_impl(std::size_t acc) { return acc; }
@@ -1207,7 +1327,21 @@ YK_POLYFILL_CXX14_CONSTEXPR detail::multi_visit_return_type<Visitor, Variants...
   using return_type = detail::multi_visit_return_type<Visitor, Variants...>;
   if (detail::any_valueless_impl(vars...)) throw bad_variant_access{};
   constexpr std::size_t total = detail::multi_visit_total_size<Variants...>::value;
-  return detail::multi_visit_table<return_type, Visitor, make_index_sequence<total>, Variants...>::value[detail::compute_flat_index(vars...)](
+  return detail::multi_visit_table<return_type, /* Convert = */ false, Visitor, make_index_sequence<total>, Variants...>::value[detail::compute_flat_index(vars...)](
+      std::forward<Visitor>(vis), std::forward<Variants>(vars)...
+  );
+}
+
+// visit<R>: every alternative's result is converted to R (or discarded if R is void).
+// The table depends only on R, the visitor and the variant types, never on what each alternative returns.
+template<
+    class R, class Visitor, class... Variants,
+    typename std::enable_if<conjunction<detail::is_variant<typename remove_cvref<Variants>::type>...>::value, std::nullptr_t>::type = nullptr>
+YK_POLYFILL_CXX14_CONSTEXPR R visit(Visitor&& vis, Variants&&... vars)
+{
+  if (detail::any_valueless_impl(vars...)) throw bad_variant_access{};
+  constexpr std::size_t total = detail::multi_visit_total_size<Variants...>::value;
+  return detail::multi_visit_table<R, /* Convert = */ true, Visitor, make_index_sequence<total>, Variants...>::value[detail::compute_flat_index(vars...)](
       std::forward<Visitor>(vis), std::forward<Variants>(vars)...
   );
 }
@@ -1215,9 +1349,7 @@ YK_POLYFILL_CXX14_CONSTEXPR detail::multi_visit_return_type<Visitor, Variants...
 // swap
 
 template<class... Ts, typename std::enable_if<conjunction<std::is_move_constructible<Ts>..., is_swappable<Ts>...>::value, std::nullptr_t>::type = nullptr>
-YK_POLYFILL_CXX20_CONSTEXPR void swap(variant<Ts...>& lhs, variant<Ts...>& rhs) noexcept(
-    conjunction<std::is_nothrow_move_constructible<Ts>..., is_nothrow_swappable<Ts>...>::value
-)
+YK_POLYFILL_CXX20_CONSTEXPR void swap(variant<Ts...>& lhs, variant<Ts...>& rhs) noexcept(noexcept(lhs.swap(rhs)))
 {
   lhs.swap(rhs);
 }
@@ -1239,131 +1371,147 @@ constexpr std::strong_ordering operator<=>(monostate, monostate) noexcept { retu
 
 namespace detail {
 
-template<std::size_t I, class Operation, class ReturnType, ReturnType DefaultValue>
-struct returning_op_wrapper {
-  template<class... Args>
-  static constexpr ReturnType apply(Args&&... args)
+// Both operands share one alternative list and the indices have already been checked equal, so the alternative is
+// reached through a balanced if-tree on the index and both unions are read with raw_get. Compared with raw_visit this
+// skips the function-pointer table and the index re-check (and throw path) of polyfill::get. For alternatives such as
+// same-width integers or enums, the leaves are identical and the optimizer folds the tree away.
+template<class Operation, std::size_t Lo, std::size_t Hi, bool Leaf = (Hi - Lo == 1)>
+struct cmp_dispatch;
+
+template<class Operation, std::size_t Lo, std::size_t Hi>
+struct cmp_dispatch<Operation, Lo, Hi, /* Leaf = */ true> {
+  template<class UnionT>
+  static constexpr typename Operation::result_type apply(UnionT const& lhs, UnionT const& rhs, std::size_t /* i == Lo */)
   {
-    return Operation::template apply<I>(std::forward<Args>(args)...);
+    return Operation::apply(detail::raw_get<Lo>(lhs), detail::raw_get<Lo>(rhs));
   }
 };
 
-template<class Operation, class ReturnType, ReturnType DefaultValue>
-struct returning_op_wrapper<variant_npos, Operation, ReturnType, DefaultValue> {
-  template<class... Args>
-  static constexpr ReturnType apply(Args&&...) noexcept
+template<class Operation, std::size_t Lo, std::size_t Hi>
+struct cmp_dispatch<Operation, Lo, Hi, /* Leaf = */ false> {
+  static constexpr std::size_t Mid = Lo + (Hi - Lo) / 2;
+
+  template<class UnionT>
+  static constexpr typename Operation::result_type apply(UnionT const& lhs, UnionT const& rhs, std::size_t i)
   {
-    return DefaultValue;
+    return i < Mid ? cmp_dispatch<Operation, Lo, Mid>::apply(lhs, rhs, i) : cmp_dispatch<Operation, Mid, Hi>::apply(lhs, rhs, i);
   }
 };
 
-struct eq_operation {
-  template<std::size_t ValidI, class ContainedT, class... Ts>
-  static constexpr bool apply(variant<Ts...> const& rhs, ContainedT const& lhs_val)
+struct variant_access {
+  template<class V>
+  static constexpr auto vunion(V&& v) noexcept -> decltype((std::forward<V>(v).vunion))
   {
-    return lhs_val == polyfill::get<ValidI>(rhs);
+    return std::forward<V>(v).vunion;
   }
-};
 
-struct ne_operation {
-  template<std::size_t ValidI, class ContainedT, class... Ts>
-  static constexpr bool apply(variant<Ts...> const& rhs, ContainedT const& lhs_val)
+  template<class... Ts>
+  static YK_POLYFILL_CXX14_CONSTEXPR variant_storage<Ts...>& storage(variant<Ts...>& v) noexcept
   {
-    return lhs_val != polyfill::get<ValidI>(rhs);
+    return v;
   }
 };
 
-struct lt_operation {
-  template<std::size_t ValidI, class ContainedT, class... Ts>
-  static constexpr bool apply(variant<Ts...> const& rhs, ContainedT const& lhs_val)
+template<>
+struct swap_operation</* TriviallyRelocatable = */ false> {
+  template<class... Ts>
+  static YK_POLYFILL_CXX20_CONSTEXPR void apply(variant<Ts...>& lhs, variant<Ts...>& rhs)
   {
-    return lhs_val < polyfill::get<ValidI>(rhs);
+    if (lhs.index() == rhs.index()) {
+      if (!lhs.valueless_by_exception()) {
+        lhs.raw_visit(swap_same_index_visitor<Ts...>{rhs});
+      }
+    } else {
+      variant<Ts...> tmp(std::move(rhs));
+      rhs = std::move(lhs);
+      lhs = std::move(tmp);
+    }
   }
 };
 
-struct le_operation {
-  template<std::size_t ValidI, class ContainedT, class... Ts>
-  static constexpr bool apply(variant<Ts...> const& rhs, ContainedT const& lhs_val)
+template<>
+struct swap_operation</* TriviallyRelocatable = */ true> {
+  template<class... Ts>
+  static YK_POLYFILL_CXX20_CONSTEXPR void apply(variant<Ts...>& lhs, variant<Ts...>& rhs) noexcept
   {
-    return lhs_val <= polyfill::get<ValidI>(rhs);
+    if (detail::is_constant_evaluated()) {
+      swap_operation<false>::apply(lhs, rhs);
+      return;
+    }
+    variant_access::storage(lhs)._relocate_swap(variant_access::storage(rhs));
   }
 };
 
-struct gt_operation {
-  template<std::size_t ValidI, class ContainedT, class... Ts>
-  static constexpr bool apply(variant<Ts...> const& rhs, ContainedT const& lhs_val)
+// precondition: lhs.index() == rhs.index() and neither is valueless
+template<class Operation, class... Ts>
+constexpr typename Operation::result_type variant_compare(variant<Ts...> const& lhs, variant<Ts...> const& rhs)
+{
+  return cmp_dispatch<Operation, 0, sizeof...(Ts)>::apply(variant_access::vunion(lhs), variant_access::vunion(rhs), lhs.index());
+}
+
+struct eq_operation {
+  using result_type = bool;
+  template<class T>
+  static constexpr bool apply(T const& lhs, T const& rhs)
   {
-    return lhs_val > polyfill::get<ValidI>(rhs);
+    return lhs == rhs;
   }
 };
 
-struct ge_operation {
-  template<std::size_t ValidI, class ContainedT, class... Ts>
-  static constexpr bool apply(variant<Ts...> const& rhs, ContainedT const& lhs_val)
+struct ne_operation {
+  using result_type = bool;
+  template<class T>
+  static constexpr bool apply(T const& lhs, T const& rhs)
   {
-    return lhs_val >= polyfill::get<ValidI>(rhs);
+    return lhs != rhs;
   }
 };
 
-template<class Operation, bool DefaultValue, class... Ts>
-struct cmp_visitor {
-  variant<Ts...> const& rhs_ref;
-  template<std::size_t I, class ContainedT>
-  constexpr bool operator()(in_place_index_t<I>, ContainedT&& lhs_val) const
+struct lt_operation {
+  using result_type = bool;
+  template<class T>
+  static constexpr bool apply(T const& lhs, T const& rhs)
   {
-    return returning_op_wrapper<I, Operation, bool, DefaultValue>::apply(rhs_ref, lhs_val);
+    return lhs < rhs;
   }
 };
 
-template<class... Ts>
-using eq_visitor = cmp_visitor<eq_operation, true, Ts...>;
-
-template<class... Ts>
-using ne_visitor = cmp_visitor<ne_operation, false, Ts...>;
-
-template<class... Ts>
-using lt_visitor = cmp_visitor<lt_operation, false, Ts...>;
-
-template<class... Ts>
-using le_visitor = cmp_visitor<le_operation, true, Ts...>;
-
-template<class... Ts>
-using gt_visitor = cmp_visitor<gt_operation, false, Ts...>;
-
-template<class... Ts>
-using ge_visitor = cmp_visitor<ge_operation, true, Ts...>;
-
-#if __cplusplus >= 202002L
+struct le_operation {
+  using result_type = bool;
+  template<class T>
+  static constexpr bool apply(T const& lhs, T const& rhs)
+  {
+    return lhs <= rhs;
+  }
+};
 
-template<class ResultType>
-struct three_way_operation {
-  template<std::size_t ValidI, class ContainedT, class... Ts>
-  static constexpr ResultType apply(variant<Ts...> const& rhs, ContainedT const& lhs_val)
+struct gt_operation {
+  using result_type = bool;
+  template<class T>
+  static constexpr bool apply(T const& lhs, T const& rhs)
   {
-    return lhs_val <=> polyfill::get<ValidI>(rhs);
+    return lhs > rhs;
   }
 };
 
-template<class ResultType>
-struct three_way_npos_operation {
-  template<std::size_t /* variant_npos */, class... Args>
-  static constexpr ResultType apply(Args&&...) noexcept
+struct ge_operation {
+  using result_type = bool;
+  template<class T>
+  static constexpr bool apply(T const& lhs, T const& rhs)
   {
-    return ResultType::equivalent;
+    return lhs >= rhs;
   }
 };
 
-template<class ResultType, class... Ts>
-struct three_way_cmp_visitor {
-  variant<Ts...> const& rhs_ref;
-  template<std::size_t I, class ContainedT>
-  constexpr ResultType operator()(in_place_index_t<I>, ContainedT&& lhs_val) const
+#if __cplusplus >= 202002L
+
+template<class ResultType>
+struct three_way_operation {
+  using result_type = ResultType;
+  template<class T>
+  static constexpr ResultType apply(T const& lhs, T const& rhs)
   {
-    if constexpr (I == variant_npos) {
-      return ResultType::equivalent;
-    } else {
-      return lhs_val <=> polyfill::get<I>(rhs_ref);
-    }
+    return lhs <=> rhs;
   }
 };
 
@@ -1380,7 +1528,7 @@ YK_POLYFILL_CXX14_CONSTEXPR
 {
   if (lhs.index() != rhs.index()) return false;
   if (lhs.valueless_by_exception()) return true;
-  return lhs.raw_visit(detail::eq_visitor<Ts...>{rhs});
+  return detail::variant_compare<detail::eq_operation>(lhs, rhs);
 }
 
 #if __cplusplus < 202002L
@@ -1393,7 +1541,7 @@ YK_POLYFILL_CXX14_CONSTEXPR bool operator!=(variant<Ts...> const& lhs, variant<T
 {
   if (lhs.index() != rhs.index()) return true;
   if (lhs.valueless_by_exception()) return false;
-  return lhs.raw_visit(detail::ne_visitor<Ts...>{rhs});
+  return detail::variant_compare<detail::ne_operation>(lhs, rhs);
 }
 
 template<
@@ -1405,7 +1553,7 @@ YK_POLYFILL_CXX14_CONSTEXPR bool operator<(variant<Ts...> const& lhs, variant<Ts
   if (rhs.valueless_by_exception()) return false;
   if (lhs.valueless_by_exception()) return true;
   if (lhs.index() != rhs.index()) return lhs.index() < rhs.index();
-  return lhs.raw_visit(detail::lt_visitor<Ts...>{rhs});
+  return detail::variant_compare<detail::lt_operation>(lhs, rhs);
 }
 
 template<
@@ -1417,7 +1565,7 @@ YK_POLYFILL_CXX14_CONSTEXPR bool operator<=(variant<Ts...> const& lhs, variant<T
   if (lhs.valueless_by_exception()) return true;
   if (rhs.valueless_by_exception()) return false;
   if (lhs.index() != rhs.index()) return lhs.index() < rhs.index();
-  return lhs.raw_visit(detail::le_visitor<Ts...>{rhs});
+  return detail::variant_compare<detail::le_operation>(lhs, rhs);
 }
 
 template<
@@ -1429,7 +1577,7 @@ YK_POLYFILL_CXX14_CONSTEXPR bool operator>(variant<Ts...> const& lhs, variant<Ts
   if (lhs.valueless_by_exception()) return false;
   if (rhs.valueless_by_exception()) return true;
   if (lhs.index() != rhs.index()) return lhs.index() > rhs.index();
-  return lhs.raw_visit(detail::gt_visitor<Ts...>{rhs});
+  return detail::variant_compare<detail::gt_operation>(lhs, rhs);
 }
 
 template<
@@ -1441,7 +1589,7 @@ YK_POLYFILL_CXX14_CONSTEXPR bool operator>=(variant<Ts...> const& lhs, variant<T
   if (rhs.valueless_by_exception()) return true;
   if (lhs.valueless_by_exception()) return false;
   if (lhs.index() != rhs.index()) return lhs.index() > rhs.index();
-  return lhs.raw_visit(detail::ge_visitor<Ts...>{rhs});
+  return detail::variant_compare<detail::ge_operation>(lhs, rhs);
 }
 
 #else  // C++20
@@ -1456,13 +1604,60 @@ constexpr std::common_comparison_category_t<std::compare_three_way_result_t<Ts>.
   if (lhs.valueless_by_exception()) return result_type::less;
   if (rhs.valueless_by_exception()) return result_type::greater;
   if (lhs.index() != rhs.index()) return lhs.index() <=> rhs.index();
-  return lhs.raw_visit(detail::three_way_cmp_visitor<result_type, Ts...>{rhs});
+  return detail::variant_compare<detail::three_way_operation<result_type>>(lhs, rhs);
 }
 
 #endif
 
+// hash
+
+namespace detail {
+
+// The alternative index is a template argument here, so mixing it in costs one multiply-xorshift round.
+template<class... Ts>
+struct hash_visitor {
+  template<std::size_t I, class ContainedT>
+  std::size_t operator()(in_place_index_t<I>, ContainedT const& val) const
+  {
+    return detail::hash_mix(std::hash<typename std::remove_const<ContainedT>::type>{}(val), I);
+  }
+
+  template<class UnionT>
+  std::size_t operator()(in_place_index_t<variant_npos>, UnionT const&) const noexcept
+  {
+    return detail::hash_valueless;
+  }
+};
+
+template<class Variant, class = void>
+struct variant_hash {};
+
+template<class... Ts>
+struct variant_hash<variant<Ts...>, void_t<decltype(std::hash<typename std::remove_const<Ts>::type>{}(std::declval<Ts const&>()))...>> {
+  std::size_t operator()(variant<Ts...> const& v) const
+      noexcept(conjunction<bool_constant<noexcept(std::hash<typename std::remove_const<Ts>::type>{}(std::declval<Ts const&>()))>...>::value)
+  {
+    return v.raw_visit(hash_visitor<Ts...>{});
+  }
+};
+
+}  // namespace detail
+
 }  // namespace polyfill
 
 }  // namespace yk
 
+// Hash specializations
+namespace std {
+
+template<>
+struct hash<yk::polyfill::monostate> {
+  constexpr std::size_t operator()(yk::polyfill::monostate) const noexcept { return yk::polyfill::detail::hash_monostate; }
+};
+
+template<class... Ts>
+struct hash<yk::polyfill::variant<Ts...>> : yk::polyfill::detail::variant_hash<yk::polyfill::variant<Ts...>> {};
+
+}  // namespace std
+
 #endif  // YK_ZZ_POLYFILL_VARIANT_HPP
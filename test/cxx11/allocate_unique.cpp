@@ -0,0 +1,136 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/allocate_unique.hpp>
+
+#include <yk/polyfill/memory.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+namespace {
+
+struct alloc_stats {
+  int allocations = 0;
+  int deallocations = 0;
+  std::size_t live = 0;
+};
+
+template<class T>
+struct counting_allocator {
+  using value_type = T;
+
+  alloc_stats* stats;
+
+  explicit counting_allocator(alloc_stats* s) noexcept : stats(s) {}
+
+  template<class U>
+  counting_allocator(counting_allocator<U> const& other) noexcept : stats(other.stats)
+  {
+  }
+
+  T* allocate(std::size_t n)
+  {
+    ++stats->allocations;
+    stats->live += n;
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept
+  {
+    ++stats->deallocations;
+    stats->live -= n;
+    std::allocator<T>{}.deallocate(p, n);
+  }
+
+  template<class U>
+  bool operator==(counting_allocator<U> const& other) const noexcept
+  {
+    return stats == other.stats;
+  }
+
+  template<class U>
+  bool operator!=(counting_allocator<U> const& other) const noexcept
+  {
+    return stats != other.stats;
+  }
+};
+
+int throw_countdown = 0;
+
+struct throws_on_nth {
+  throws_on_nth()
+  {
+    if (--throw_countdown == 0) throw std::runtime_error("throws_on_nth");
+  }
+};
+
+}  // namespace
+
+TEST_CASE("allocate_unique")
+{
+  // stateless allocators are elided from the deleter
+  STATIC_REQUIRE(sizeof(pf::unique_ptr<int, ext::allocator_delete<int, std::allocator<int>>>) == sizeof(int*));
+  STATIC_REQUIRE(std::is_same<ext::allocator_delete<int, std::allocator<char>>::allocator_type, std::allocator<int>>::value);
+
+  SECTION("object")
+  {
+    alloc_stats stats;
+    {
+      auto p = ext::allocate_unique<std::string>(counting_allocator<char>(&stats), 3, 'x');
+      STATIC_REQUIRE(std::is_same<decltype(p), pf::unique_ptr<std::string, ext::allocator_delete<std::string, counting_allocator<char>>>>::value);
+      CHECK(*p == "xxx");
+      CHECK(stats.allocations == 1);
+      CHECK(p.get_deleter().get_allocator().stats == &stats);
+    }
+    CHECK(stats.deallocations == 1);
+    CHECK(stats.live == 0);
+  }
+
+  SECTION("array")
+  {
+    alloc_stats stats;
+    {
+      auto p = ext::allocate_unique<int[]>(counting_allocator<int>(&stats), 4);
+      STATIC_REQUIRE(std::is_same<decltype(p), pf::unique_ptr<int[], ext::allocator_delete<int[], counting_allocator<int>>>>::value);
+      CHECK(stats.live == 4);
+      CHECK(p.get_deleter().size() == 4);
+      for (int i = 0; i < 4; ++i) CHECK(p[i] == 0);
+    }
+    CHECK(stats.live == 0);
+  }
+
+  SECTION("for_overwrite")
+  {
+    alloc_stats stats;
+    {
+      auto p = ext::allocate_unique_for_overwrite<int>(counting_allocator<int>(&stats));
+      *p = 1;
+      auto q = ext::allocate_unique_for_overwrite<int[]>(counting_allocator<int>(&stats), 8);
+      q[7] = 2;
+      CHECK(stats.live == 9);
+    }
+    CHECK(stats.live == 0);
+    CHECK(stats.allocations == stats.deallocations);
+  }
+
+  SECTION("exception during construction returns the storage")
+  {
+    alloc_stats stats;
+    throw_countdown = 3;
+    CHECK_THROWS_AS(ext::allocate_unique<throws_on_nth[]>(counting_allocator<throws_on_nth>(&stats), 5), std::runtime_error);
+    CHECK(stats.allocations == 1);
+    CHECK(stats.deallocations == 1);
+    CHECK(stats.live == 0);
+  }
+}
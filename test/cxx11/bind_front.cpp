@@ -0,0 +1,114 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/functional.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace pf = yk::polyfill;
+
+namespace {
+
+struct Minus {
+  constexpr int operator()(int a, int b) const noexcept { return a - b; }
+};
+
+struct Handler {
+  int base;
+  int handle(int x) const { return base + x; }
+};
+
+struct CallHandler {
+  int operator()(Handler const* h, int x) const { return h->handle(x); }
+};
+
+struct ValueCategory {
+  int operator()() & { return 0; }
+  int operator()() const& { return 1; }
+  int operator()() && { return 2; }
+  int operator()() const&& { return 3; }
+};
+
+struct Concat {
+  std::string operator()(std::string const& a, std::string const& b) const { return a + b; }
+};
+
+struct TakeOwnership {
+  int operator()(std::unique_ptr<int>&& p) const { return *p; }
+  int operator()(std::unique_ptr<int> const& p) const { return -*p; }
+};
+
+}  // namespace
+
+TEST_CASE("bind_front")
+{
+  CHECK(pf::bind_front(Minus{}, 10)(3) == 7);
+  CHECK(pf::bind_front(Minus{})(10, 3) == 7);
+  CHECK(pf::bind_front(Minus{}, 10, 3)() == 7);
+
+  // stateless callable + one pointer is pointer-sized
+  Handler h{40};
+  auto bound = pf::bind_front(CallHandler{}, &h);
+  STATIC_REQUIRE(sizeof(bound) == sizeof(Handler const*));
+  CHECK(bound(2) == 42);
+
+  // member function pointers go through invoke
+  CHECK(pf::bind_front(&Handler::handle, &h)(1) == 41);
+  CHECK(pf::bind_front(&Handler::handle, std::ref(h))(2) == 42);
+  CHECK(pf::bind_front(&Handler::base, h)() == 40);
+
+  // bound arguments are copies
+  std::string hello = "hello";
+  auto greet = pf::bind_front(Concat{}, hello);
+  hello = "bye";
+  CHECK(greet(" world") == "hello world");
+
+  // value category of the binder is forwarded to the callable
+  auto vc = pf::bind_front(ValueCategory{});
+  auto const& cvc = vc;
+  CHECK(vc() == 0);
+  CHECK(cvc() == 1);
+  CHECK(std::move(vc)() == 2);
+  CHECK(std::move(cvc)() == 3);
+
+  auto owner = pf::bind_front(TakeOwnership{}, std::unique_ptr<int>(new int(5)));
+  CHECK(owner() == -5);
+  CHECK(std::move(owner)() == 5);
+
+  STATIC_REQUIRE(noexcept(std::declval<decltype(pf::bind_front(Minus{}, 1))&>()(2)));
+  STATIC_REQUIRE(!noexcept(std::declval<decltype(pf::bind_front(Concat{}, std::string()))&>()("")));
+  STATIC_REQUIRE(!pf::is_invocable<decltype(pf::bind_front(Minus{}, 1))>::value);
+  STATIC_REQUIRE(pf::is_invocable<decltype(pf::bind_front(Minus{}, 1)), int>::value);
+}
+
+TEST_CASE("bind_back")
+{
+  CHECK(pf::bind_back(Minus{}, 3)(10) == 7);
+  CHECK(pf::bind_back(Minus{})(10, 3) == 7);
+
+  Handler h{40};
+  CHECK(pf::bind_back(&Handler::handle, 2)(h) == 42);
+  CHECK(pf::bind_back(Concat{}, std::string("!"))("hi") == "hi!");
+
+  auto bound = pf::bind_back(Minus{}, 1);
+  STATIC_REQUIRE(sizeof(bound) == sizeof(int));
+
+  auto vc = pf::bind_back(ValueCategory{});
+  CHECK(std::move(vc)() == 2);
+}
+
+#if __cplusplus >= 201402L
+TEST_CASE("bind_front is constexpr")
+{
+  constexpr auto minus_ten = pf::bind_back(Minus{}, 10);
+  STATIC_REQUIRE(minus_ten(15) == 5);
+  STATIC_REQUIRE(pf::bind_front(Minus{}, 15)(10) == 5);
+}
+#endif
@@ -0,0 +1,113 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/bit.hpp>
+
+#include <cstdint>
+
+namespace pf = yk::polyfill;
+
+namespace {
+
+template<class T, class = void>
+struct has_popcount : std::false_type {};
+
+template<class T>
+struct has_popcount<T, decltype(void(pf::popcount(T())))> : std::true_type {};
+
+}  // namespace
+
+TEST_CASE("popcount")
+{
+  STATIC_REQUIRE(pf::popcount(0u) == 0);
+  STATIC_REQUIRE(pf::popcount(0xFFu) == 8);
+  STATIC_REQUIRE(pf::popcount(std::uint8_t{0xA5}) == 4);
+  STATIC_REQUIRE(pf::popcount(std::uint16_t{0xFFFF}) == 16);
+  STATIC_REQUIRE(pf::popcount(std::uint64_t{0xFFFFFFFFFFFFFFFFull}) == 64);
+  STATIC_REQUIRE(pf::popcount(0x8000000000000001ull) == 2);
+
+  STATIC_REQUIRE(has_popcount<unsigned>::value);
+  STATIC_REQUIRE(!has_popcount<int>::value);
+  STATIC_REQUIRE(!has_popcount<bool>::value);
+  STATIC_REQUIRE(!has_popcount<char32_t>::value);
+
+  std::uint32_t x = 0x12345678u;
+  CHECK(pf::popcount(x) == 13);
+}
+
+TEST_CASE("countl_zero / countr_zero")
+{
+  STATIC_REQUIRE(pf::countl_zero(std::uint8_t{0}) == 8);
+  STATIC_REQUIRE(pf::countl_zero(std::uint8_t{1}) == 7);
+  STATIC_REQUIRE(pf::countl_zero(std::uint16_t{0x00FF}) == 8);
+  STATIC_REQUIRE(pf::countl_zero(std::uint32_t{1}) == 31);
+  STATIC_REQUIRE(pf::countl_zero(std::uint64_t{0}) == 64);
+  STATIC_REQUIRE(pf::countl_zero(std::uint64_t{1} << 40) == 23);
+
+  STATIC_REQUIRE(pf::countr_zero(std::uint8_t{0}) == 8);
+  STATIC_REQUIRE(pf::countr_zero(std::uint16_t{0x100}) == 8);
+  STATIC_REQUIRE(pf::countr_zero(std::uint64_t{1} << 63) == 63);
+
+  STATIC_REQUIRE(pf::countl_one(std::uint8_t{0xF0}) == 4);
+  STATIC_REQUIRE(pf::countl_one(std::uint32_t{0xFFFFFFFFu}) == 32);
+  STATIC_REQUIRE(pf::countr_one(std::uint16_t{0x00FF}) == 8);
+
+  for (int i = 0; i < 64; ++i) {
+    std::uint64_t const v = std::uint64_t{1} << i;
+    CHECK(pf::countr_zero(v) == i);
+    CHECK(pf::countl_zero(v) == 63 - i);
+  }
+}
+
+TEST_CASE("bit_width / bit_floor / bit_ceil / has_single_bit")
+{
+  STATIC_REQUIRE(pf::bit_width(0u) == 0);
+  STATIC_REQUIRE(pf::bit_width(1u) == 1);
+  STATIC_REQUIRE(pf::bit_width(255u) == 8);
+  STATIC_REQUIRE(pf::bit_width(256u) == 9);
+
+  STATIC_REQUIRE(pf::bit_floor(0u) == 0u);
+  STATIC_REQUIRE(pf::bit_floor(1u) == 1u);
+  STATIC_REQUIRE(pf::bit_floor(300u) == 256u);
+  STATIC_REQUIRE(pf::bit_floor(std::uint8_t{0xFF}) == 0x80);
+
+  STATIC_REQUIRE(pf::bit_ceil(0u) == 1u);
+  STATIC_REQUIRE(pf::bit_ceil(1u) == 1u);
+  STATIC_REQUIRE(pf::bit_ceil(3u) == 4u);
+  STATIC_REQUIRE(pf::bit_ceil(256u) == 256u);
+  STATIC_REQUIRE(pf::bit_ceil(std::uint8_t{100}) == 128);
+  STATIC_REQUIRE(pf::bit_ceil(std::uint64_t{1} << 40 | 1) == std::uint64_t{1} << 41);
+
+  STATIC_REQUIRE(!pf::has_single_bit(0u));
+  STATIC_REQUIRE(pf::has_single_bit(64u));
+  STATIC_REQUIRE(!pf::has_single_bit(65u));
+}
+
+TEST_CASE("rotl / rotr")
+{
+  STATIC_REQUIRE(pf::rotl(std::uint8_t{0x81}, 1) == 0x03);
+  STATIC_REQUIRE(pf::rotl(std::uint8_t{0x81}, 9) == 0x03);
+  STATIC_REQUIRE(pf::rotl(std::uint8_t{0x81}, -1) == 0xC0);
+  STATIC_REQUIRE(pf::rotl(std::uint8_t{0x81}, 0) == 0x81);
+  STATIC_REQUIRE(pf::rotr(std::uint8_t{0x81}, 1) == 0xC0);
+  STATIC_REQUIRE(pf::rotr(std::uint8_t{0x81}, -1) == 0x03);
+  STATIC_REQUIRE(pf::rotl(std::uint32_t{0x12345678u}, 8) == 0x34567812u);
+  STATIC_REQUIRE(pf::rotr(std::uint64_t{1}, 1) == std::uint64_t{1} << 63);
+  STATIC_REQUIRE(pf::rotr(std::uint16_t{0x1234}, 16) == 0x1234);
+}
+
+TEST_CASE("byteswap")
+{
+  STATIC_REQUIRE(pf::byteswap(std::uint8_t{0xAB}) == 0xAB);
+  STATIC_REQUIRE(pf::byteswap(std::uint16_t{0x1234}) == 0x3412);
+  STATIC_REQUIRE(pf::byteswap(std::uint32_t{0x12345678u}) == 0x78563412u);
+  STATIC_REQUIRE(pf::byteswap(std::uint64_t{0x0123456789ABCDEFull}) == 0xEFCDAB8967452301ull);
+  STATIC_REQUIRE(pf::byteswap(std::int32_t{1}) == std::int32_t{0x01000000});
+  STATIC_REQUIRE(pf::byteswap(std::int16_t{-2}) == std::int16_t{-257});
+
+  std::uint32_t x = 0xDEADBEEFu;
+  CHECK(pf::byteswap(pf::byteswap(x)) == x);
+}
@@ -11,6 +11,15 @@
 
 namespace pf = yk::polyfill;
 
+namespace {
+
+struct NoDefault {
+  std::uint32_t bits;
+  explicit NoDefault(std::uint32_t b) : bits(b) {}
+};
+
+}  // namespace
+
 TEST_CASE("bit_cast")
 {
   SECTION("float to uint32_t")
@@ -38,4 +47,23 @@ TEST_CASE("bit_cast")
     double d2 = pf::bit_cast<double>(u);
     CHECK(d == d2);
   }
+
+  SECTION("scratch object")
+  {
+    NoDefault const scratch(0);
+    CHECK(pf::bit_cast<NoDefault>(std::uint32_t{42}, scratch).bits == 42);
+#if YK_POLYFILL_CONSTEXPR_BIT_CAST
+    CHECK(pf::bit_cast<NoDefault>(std::uint32_t{42}).bits == 42);
+#endif
+  }
 }
+
+#if YK_POLYFILL_CONSTEXPR_BIT_CAST
+TEST_CASE("bit_cast is constexpr")
+{
+  STATIC_REQUIRE(pf::bit_cast<std::uint32_t>(1.0f) == 0x3F800000u || !std::numeric_limits<float>::is_iec559);
+  STATIC_REQUIRE(pf::bit_cast<std::uint64_t>(-0.0) == 0x8000000000000000ull || !std::numeric_limits<double>::is_iec559);
+  STATIC_REQUIRE(pf::bit_cast<float>(pf::bit_cast<std::uint32_t>(0.5f)) == 0.5f);
+  STATIC_REQUIRE(pf::bit_cast<std::int32_t>(std::uint32_t{0xFFFFFFFFu}, std::int32_t{}) == -1);
+}
+#endif
@@ -0,0 +1,151 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/boxed_variant.hpp>
+
+#include <yk/polyfill/variant.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+namespace {
+
+struct large_message {
+  int payload[100];
+  int id;
+
+  large_message() : payload(), id(0) {}
+  explicit large_message(int i) : payload(), id(i) {}
+
+  bool operator==(large_message const& other) const { return id == other.id; }
+  bool operator!=(large_message const& other) const { return id != other.id; }
+};
+
+struct id_visitor {
+  int operator()(int i) const { return i; }
+  int operator()(large_message const& m) const { return m.id; }
+};
+
+struct sum_visitor {
+  template<class A, class B>
+  int operator()(A const& a, B const& b) const
+  {
+    return id_visitor{}(a) + id_visitor{}(b);
+  }
+};
+
+}  // namespace
+
+TEST_CASE("boxed_variant")
+{
+  using V = ext::boxed_variant<int, ext::boxed<large_message>>;
+
+  STATIC_REQUIRE(std::is_same<V::variant_type, pf::variant<int, pf::indirect<large_message>>>::value);
+  STATIC_REQUIRE(sizeof(V) == sizeof(pf::variant<int, pf::indirect<large_message>>));
+  STATIC_REQUIRE(sizeof(V) < sizeof(large_message));
+  STATIC_REQUIRE(std::is_same<pf::variant_alternative<1, V>::type, large_message>::value);
+  STATIC_REQUIRE(pf::variant_size<V>::value == 2);
+  STATIC_REQUIRE(std::is_same<decltype(ext::get<1>(std::declval<V&>())), large_message&>::value);
+  STATIC_REQUIRE(std::is_same<decltype(ext::get<large_message>(std::declval<V const&>())), large_message const&>::value);
+  STATIC_REQUIRE(std::is_same<decltype(ext::get<1>(std::declval<V&&>())), large_message&&>::value);
+
+  SECTION("construction")
+  {
+    V a;
+    CHECK(a.index() == 0);
+    CHECK(ext::get<0>(a) == 0);
+
+    V b = large_message(7);
+    CHECK(b.index() == 1);
+    CHECK(ext::holds_alternative<large_message>(b));
+    CHECK(ext::get<large_message>(b).id == 7);
+    CHECK_THROWS_AS(ext::get<int>(b), pf::bad_variant_access);
+
+    V c(pf::in_place_index_t<1>{}, 3);
+    CHECK(ext::get<1>(c).id == 3);
+
+    V d(pf::in_place_type_t<large_message>{}, 4);
+    CHECK(ext::get_if<large_message>(&d)->id == 4);
+    CHECK(ext::get_if<int>(&d) == nullptr);
+  }
+
+  SECTION("boxed default alternative")
+  {
+    ext::boxed_variant<ext::boxed<std::string>, int> v;
+    CHECK(v.index() == 0);
+    CHECK(ext::get<std::string>(v).empty());
+    v = "abc";
+    CHECK(ext::get<0>(v) == "abc");
+  }
+
+  SECTION("assignment and emplace")
+  {
+    V v = 1;
+    v = large_message(5);
+    CHECK(ext::get<1>(v).id == 5);
+
+    large_message* storage = &ext::get<1>(v);
+    v = large_message(6);
+    CHECK(&ext::get<1>(v) == storage);  // assigning the active boxed alternative reuses its allocation
+    CHECK(ext::get<1>(v).id == 6);
+
+    v.emplace<int>(9);
+    CHECK(ext::get<int>(v) == 9);
+    CHECK(v.emplace<1>(10).id == 10);
+  }
+
+  SECTION("copy and move")
+  {
+    V a = large_message(1);
+    V b = a;
+    CHECK(&ext::get<1>(a) != &ext::get<1>(b));
+    CHECK(a == b);
+
+    large_message* storage = &ext::get<1>(b);
+    V c = std::move(b);
+    CHECK(&ext::get<1>(c) == storage);  // moving transfers the box
+
+    c = 3;
+    CHECK(a != c);
+  }
+
+  SECTION("assignment to a moved-from box")
+  {
+    V a = large_message(1);
+    V b = std::move(a);
+    REQUIRE(a.index() == 1);
+    CHECK(pf::get<1>(a.base()).valueless_after_move());
+
+    a = large_message(2);
+    CHECK(ext::get<1>(a).id == 2);
+    CHECK(ext::get<1>(b).id == 1);
+  }
+
+  SECTION("visit")
+  {
+    V a = 2;
+    V b = large_message(40);
+    CHECK(ext::visit(id_visitor{}, a) == 2);
+    CHECK(ext::visit(id_visitor{}, b) == 40);
+    CHECK(ext::visit(sum_visitor{}, a, b) == 42);
+  }
+
+  SECTION("swap")
+  {
+    V a = 1;
+    V b = large_message(2);
+    large_message* storage = &ext::get<1>(b);
+    swap(a, b);
+    CHECK(&ext::get<1>(a) == storage);
+    CHECK(ext::get<0>(b) == 1);
+  }
+}
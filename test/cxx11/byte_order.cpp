@@ -0,0 +1,104 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/byte_order.hpp>
+
+#include <yk/polyfill/bit.hpp>
+
+#include <limits>
+#include <vector>
+
+#include <cstdint>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+namespace {
+
+enum class tag : std::uint16_t { a = 0x0102 };
+
+}  // namespace
+
+TEST_CASE("load_le / load_be")
+{
+  STATIC_REQUIRE(pf::endian::native == pf::endian::little || pf::endian::native == pf::endian::big);
+
+  // offset by one so that every multi-byte access is misaligned
+  unsigned char const buf[] = {0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+  unsigned char const* p = buf + 1;
+
+  CHECK(ext::load_le<std::uint8_t>(p) == 0x01);
+  CHECK(ext::load_le<std::uint16_t>(p) == 0x0201);
+  CHECK(ext::load_be<std::uint16_t>(p) == 0x0102);
+  CHECK(ext::load_le<std::uint32_t>(p) == 0x04030201u);
+  CHECK(ext::load_be<std::uint32_t>(p) == 0x01020304u);
+  CHECK(ext::load_le<std::uint64_t>(p) == 0x0807060504030201ull);
+  CHECK(ext::load_be<std::uint64_t>(p) == 0x0102030405060708ull);
+  CHECK(ext::load_be<std::int16_t>(buf) == std::int16_t{-255});
+  CHECK(ext::load_be<tag>(p) == tag::a);
+}
+
+TEST_CASE("store_le / store_be")
+{
+  unsigned char buf[9] = {};
+  ext::store_le(buf + 1, std::uint32_t{0x01020304u});
+  CHECK(buf[1] == 0x04);
+  CHECK(buf[4] == 0x01);
+  ext::store_be(buf + 1, std::uint32_t{0x01020304u});
+  CHECK(buf[1] == 0x01);
+  CHECK(buf[4] == 0x04);
+
+  if (std::numeric_limits<double>::is_iec559) {
+    ext::store_be(buf + 1, 1.0);
+    CHECK(buf[1] == 0x3F);
+    CHECK(buf[2] == 0xF0);
+    CHECK(ext::load_be<double>(buf + 1) == 1.0);
+
+    ext::store_le(buf + 1, -2.5f);
+    CHECK(ext::load_le<float>(buf + 1) == -2.5f);
+    CHECK(ext::load_le<std::uint32_t>(buf + 1) == pf::bit_cast<std::uint32_t>(-2.5f));
+  }
+}
+
+TEST_CASE("load_le_n / store_be_n")
+{
+  std::vector<std::uint32_t> values;
+  for (std::uint32_t i = 0; i < 37; ++i) values.push_back(0x11223300u + i);
+
+  std::vector<unsigned char> bytes(values.size() * 4 + 1);
+  for (int order = 0; order < 2; ++order) {
+    unsigned char* const begin = bytes.data() + 1;
+    unsigned char* const end = order == 0 ? ext::store_le_n(values.data(), values.size(), begin) : ext::store_be_n(values.data(), values.size(), begin);
+    CHECK(end == begin + values.size() * 4);
+    CHECK(begin[4] == (order == 0 ? 0x01 : 0x11));
+    CHECK(begin[7] == (order == 0 ? 0x11 : 0x01));
+
+    std::vector<std::uint32_t> decoded(values.size());
+    unsigned char const* const rest =
+        order == 0 ? ext::load_le_n(begin, decoded.size(), decoded.data()) : ext::load_be_n(begin, decoded.size(), decoded.data());
+    CHECK(rest == end);
+    CHECK(decoded == values);
+  }
+
+  CHECK(ext::load_be_n(bytes.data(), 0, static_cast<std::uint16_t*>(nullptr)) == bytes.data());
+}
+
+#if __cpp_lib_span >= 202002L
+TEST_CASE("byte_order spans")
+{
+  std::uint16_t const values[] = {0x0102, 0x0304, 0x0506};
+  unsigned char bytes[7] = {};
+  std::span<unsigned char> rest = ext::store_be(std::span(values), std::span(bytes));
+  CHECK(rest.size() == 1);
+  CHECK(bytes[0] == 0x01);
+  CHECK(bytes[5] == 0x06);
+
+  std::uint16_t decoded[3] = {};
+  std::span<unsigned char const> unread = ext::load_be(std::span<unsigned char const>(bytes), std::span(decoded));
+  CHECK(unread.size() == 1);
+  CHECK(decoded[2] == 0x0506);
+}
+#endif
@@ -0,0 +1,115 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/dispatch_index.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+namespace {
+
+template<std::size_t Width>
+int sum_blocks(int const* data, std::size_t n)
+{
+  int sum = 0;
+  for (std::size_t i = 0; i + Width <= n; i += Width) {
+    for (std::size_t j = 0; j < Width; ++j) sum += data[i + j];
+  }
+  return sum;
+}
+
+struct SumBlocks {
+  int const* data;
+  std::size_t n;
+
+  template<std::size_t Log2Width>
+  int operator()(pf::integral_constant<std::size_t, Log2Width>) const
+  {
+    return sum_blocks<(std::size_t{1} << Log2Width)>(data, n);
+  }
+};
+
+struct Identity {
+  template<std::size_t I>
+  constexpr std::size_t operator()(pf::integral_constant<std::size_t, I>) const
+  {
+    return I;
+  }
+};
+
+struct Encode {
+  template<std::size_t I, std::size_t J, std::size_t K>
+  constexpr std::size_t operator()(pf::integral_constant<std::size_t, I>, pf::integral_constant<std::size_t, J>, pf::integral_constant<std::size_t, K>) const
+  {
+    return I * 100 + J * 10 + K;
+  }
+};
+
+struct FirstIsDouble {
+  double operator()(pf::integral_constant<std::size_t, 0>) const { return 0.5; }
+  int operator()(pf::integral_constant<std::size_t, 1>) const { return 1; }
+};
+
+struct Appender {
+  std::string* out;
+
+  template<std::size_t I>
+  void operator()(pf::integral_constant<std::size_t, I>) &&
+  {
+    out->append(I, '*');
+  }
+};
+
+}  // namespace
+
+TEST_CASE("dispatch_index")
+{
+  for (std::size_t i = 0; i < 16; ++i) CHECK(ext::dispatch_index<16>(i, Identity{}) == i);
+
+  int const data[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  CHECK(ext::dispatch_index<4>(0, SumBlocks{data, 9}) == 45);
+  CHECK(ext::dispatch_index<4>(2, SumBlocks{data, 9}) == 36);
+  CHECK(ext::dispatch_index<4>(3, SumBlocks{data, 9}) == 36);
+
+  CHECK_THROWS_AS(ext::dispatch_index<4>(4, Identity{}), std::out_of_range);
+  CHECK_THROWS_AS(ext::dispatch_index<4>(-1, Identity{}), std::out_of_range);
+
+  // results are converted to the result type for index 0
+  STATIC_REQUIRE(std::is_same<decltype(ext::dispatch_index<2>(1, FirstIsDouble{})), double>::value);
+  CHECK(ext::dispatch_index<2>(1, FirstIsDouble{}) == 1.0);
+
+  // the function is forwarded with its value category
+  std::string out;
+  ext::dispatch_index<5>(3, Appender{&out});
+  CHECK(out == "***");
+}
+
+TEST_CASE("dispatch_index with several indices")
+{
+  for (std::size_t i = 0; i < 2; ++i) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      for (std::size_t k = 0; k < 4; ++k) CHECK(ext::dispatch_index<2, 3, 4>(i, j, k, Encode{}) == i * 100 + j * 10 + k);
+    }
+  }
+
+  CHECK_THROWS_AS((ext::dispatch_index<2, 3, 4>(0, 3, 0, Encode{})), std::out_of_range);
+  CHECK_THROWS_AS((ext::dispatch_index<2, 3, 4>(2, 0, 0, Encode{})), std::out_of_range);
+  CHECK_THROWS_AS((ext::dispatch_index<2, 3, 4>(0, 0, 4, Encode{})), std::out_of_range);
+}
+
+#if __cplusplus >= 201402L
+TEST_CASE("dispatch_index is constexpr")
+{
+  STATIC_REQUIRE(ext::dispatch_index<8>(5, Identity{}) == 5);
+  STATIC_REQUIRE(ext::dispatch_index<2, 3, 4>(1, 2, 3, Encode{}) == 123);
+}
+#endif
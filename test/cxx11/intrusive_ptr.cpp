@@ -0,0 +1,153 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/intrusive_ptr.hpp>
+
+#include <functional>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+namespace {
+
+int g_destroyed = 0;
+
+struct node : ext::intrusive_ref_counter<node> {
+  int value;
+  explicit node(int v = 0) : value(v) {}
+  virtual ~node() { ++g_destroyed; }
+};
+
+struct derived_node : node {
+  explicit derived_node(int v) : node(v) {}
+};
+
+struct local_node : ext::intrusive_ref_counter<local_node, ext::thread_unsafe_counter> {
+  int value = 0;
+  ~local_node() { ++g_destroyed; }
+};
+
+// Type with its own counting hooks, used through a custom policy
+struct handle {
+  int refs = 0;
+};
+
+struct handle_policy {
+  static void add_ref(handle* h) noexcept { ++h->refs; }
+  static void release(handle* h) noexcept { --h->refs; }
+};
+
+}  // namespace
+
+TEST_CASE("intrusive_ptr")
+{
+  STATIC_REQUIRE(sizeof(ext::intrusive_ptr<node>) == sizeof(node*));
+  STATIC_REQUIRE(!std::is_convertible<ext::intrusive_ptr<node>, bool>::value);
+
+  g_destroyed = 0;
+
+  SECTION("basic ownership")
+  {
+    {
+      ext::intrusive_ptr<node> p = ext::make_intrusive<node>(42);
+      CHECK(p->value == 42);
+      CHECK(p->use_count() == 1);
+      {
+        ext::intrusive_ptr<node> q = p;
+        CHECK(p->use_count() == 2);
+        CHECK(p == q);
+      }
+      CHECK(p->use_count() == 1);
+      ext::intrusive_ptr<node> r = std::move(p);
+      CHECK(!p);
+      CHECK(p == nullptr);
+      CHECK(r->use_count() == 1);
+      CHECK(g_destroyed == 0);
+    }
+    CHECK(g_destroyed == 1);
+  }
+
+  SECTION("raw pointer shares the embedded count")
+  {
+    node* raw = new node(1);
+    ext::intrusive_ptr<node> a(raw);
+    ext::intrusive_ptr<node> b(raw);
+    CHECK(raw->use_count() == 2);
+    a.reset();
+    CHECK(raw->use_count() == 1);
+    CHECK(g_destroyed == 0);
+    b = nullptr;
+    CHECK(g_destroyed == 1);
+  }
+
+  SECTION("detach and adopt")
+  {
+    auto p = ext::make_intrusive<node>(7);
+    node* raw = p.detach();
+    CHECK(!p);
+    CHECK(raw->use_count() == 1);
+    ext::intrusive_ptr<node> q(raw, false);
+    CHECK(raw->use_count() == 1);
+  }
+
+  SECTION("converting")
+  {
+    ext::intrusive_ptr<derived_node> d = ext::make_intrusive<derived_node>(3);
+    ext::intrusive_ptr<node> b = d;
+    CHECK(b->use_count() == 2);
+    CHECK(b == d);
+    ext::intrusive_ptr<node> c = std::move(d);
+    CHECK(c->use_count() == 2);
+    b = nullptr;
+    c = nullptr;
+    CHECK(g_destroyed == 1);
+  }
+
+  SECTION("copying the object does not copy the count")
+  {
+    auto p = ext::make_intrusive<node>(5);
+    node copy = *p;
+    CHECK(copy.use_count() == 0);
+    CHECK(copy.value == 5);
+  }
+
+  SECTION("non-atomic counter")
+  {
+    {
+      auto p = ext::make_intrusive<local_node>();
+      auto q = p;
+      CHECK(p->use_count() == 2);
+      swap(p, q);
+      CHECK(q->use_count() == 2);
+    }
+    CHECK(g_destroyed == 1);
+  }
+
+  SECTION("custom policy")
+  {
+    handle h;
+    {
+      ext::intrusive_ptr<handle, handle_policy> p(&h);
+      auto q = p;
+      CHECK(h.refs == 2);
+    }
+    CHECK(h.refs == 0);
+  }
+
+  SECTION("hash")
+  {
+    auto p = ext::make_intrusive<node>(1);
+    CHECK(std::hash<ext::intrusive_ptr<node>>{}(p) == std::hash<node*>{}(p.get()));
+    std::unordered_set<ext::intrusive_ptr<node>> set;
+    set.insert(p);
+    set.insert(p);
+    CHECK(set.size() == 1);
+    CHECK(p->use_count() == 2);
+  }
+}
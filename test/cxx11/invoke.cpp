@@ -287,6 +287,11 @@ struct NothrowConvertible {
   NothrowConvertible(int) noexcept {}
 };
 
+struct RefQualifiedCallable {
+  int operator()() & { return 1; }
+  int operator()() && noexcept { return 2; }
+};
+
 struct InvocationIsThrowing {
   void mutation_member_function(ThrowingConvertible) {}
   void const_member_function(ThrowingConvertible) const {}
@@ -317,6 +322,27 @@ TEST_CASE("invoke")
     CHECK(pf::invoke(fn, 33, 4) == 37);
   }
 
+  // value category of the function object is forwarded
+  {
+    CHECK(pf::invoke(RefQualifiedCallable{}) == 2);
+    RefQualifiedCallable callable;
+    CHECK(pf::invoke(callable) == 1);
+    STATIC_REQUIRE(noexcept(pf::invoke(callable)) == false);
+    STATIC_REQUIRE(noexcept(pf::invoke(RefQualifiedCallable{})) == true);
+#if __cpp_noexcept_function_type >= 201510L
+    STATIC_REQUIRE(noexcept(pf::invoke(&nothrow_function, 1, 2)) == true);
+#endif
+  }
+
+  // pointer to member held in a (const) variable
+  {
+    S s{12};
+    auto const pmf = &S::const_member_function;
+    auto pmd = &S::value;
+    CHECK(pf::invoke(pmf, s, 1) == 13);
+    CHECK(pf::invoke(pmd, s) == 12);
+  }
+
   // member function pointer + object (lvalue)
   {
     S s{12};
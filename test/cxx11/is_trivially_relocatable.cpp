@@ -0,0 +1,75 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/is_trivially_relocatable.hpp>
+
+#include <yk/polyfill/indirect.hpp>
+#include <yk/polyfill/memory.hpp>
+
+#include <memory>
+#include <string>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+namespace {
+
+struct StatefulDeleter {
+  StatefulDeleter() = default;
+  StatefulDeleter(StatefulDeleter const&) {}
+  void operator()(int* p) const noexcept { delete p; }
+};
+
+struct SelfReferencing {
+  SelfReferencing* self = this;
+  SelfReferencing() = default;
+  SelfReferencing(SelfReferencing const&) : self(this) {}
+};
+
+struct Relocatable {
+  Relocatable(Relocatable const&) {}
+};
+
+}  // namespace
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+template<>
+struct is_trivially_relocatable<Relocatable> : true_type {};
+
+}  // namespace extension
+
+}  // namespace polyfill
+
+}  // namespace yk
+
+TEST_CASE("is_trivially_relocatable")
+{
+  STATIC_REQUIRE(ext::is_trivially_relocatable<int>::value);
+  STATIC_REQUIRE(ext::is_trivially_relocatable<int const>::value);
+  STATIC_REQUIRE(ext::is_trivially_relocatable<int*>::value);
+  STATIC_REQUIRE(!ext::is_trivially_relocatable<SelfReferencing>::value);
+  STATIC_REQUIRE(!ext::is_trivially_relocatable<std::string>::value);
+
+  STATIC_REQUIRE(ext::is_trivially_relocatable<Relocatable>::value);
+  STATIC_REQUIRE(ext::is_trivially_relocatable<Relocatable const>::value);
+
+  STATIC_REQUIRE(ext::is_trivially_relocatable<std::allocator<int>>::value);
+  STATIC_REQUIRE(ext::is_trivially_relocatable<std::unique_ptr<int>>::value);
+  STATIC_REQUIRE(ext::is_trivially_relocatable<std::unique_ptr<int[]>>::value);
+  STATIC_REQUIRE(!ext::is_trivially_relocatable<std::unique_ptr<int, StatefulDeleter>>::value);
+
+  STATIC_REQUIRE(ext::is_trivially_relocatable<pf::unique_ptr<int>>::value);
+  STATIC_REQUIRE(ext::is_trivially_relocatable<pf::unique_ptr<int[]>>::value);
+  STATIC_REQUIRE(!ext::is_trivially_relocatable<pf::unique_ptr<int, StatefulDeleter>>::value);
+
+  STATIC_REQUIRE(ext::is_trivially_relocatable<pf::indirect<int>>::value);
+  STATIC_REQUIRE(ext::is_trivially_relocatable<pf::indirect<std::string>>::value);
+}
@@ -22,3 +22,19 @@ TEST_CASE("make_unique")
     STATIC_REQUIRE(std::is_same<decltype(x), pf::unique_ptr<int[]>>::value);
   }
 }
+
+TEST_CASE("make_unique_for_overwrite")
+{
+  {
+    auto x = pf::make_unique_for_overwrite<int>();
+    STATIC_REQUIRE(std::is_same<decltype(x), pf::unique_ptr<int>>::value);
+    *x = 42;
+    CHECK(*x == 42);
+  }
+  {
+    auto x = pf::make_unique_for_overwrite<int[]>(5);
+    STATIC_REQUIRE(std::is_same<decltype(x), pf::unique_ptr<int[]>>::value);
+    x[4] = 42;
+    CHECK(x[4] == 42);
+  }
+}
@@ -7,8 +7,11 @@
 #include <yk/polyfill/optional.hpp>
 #include <yk/polyfill/utility.hpp>
 
+#include <functional>
 #include <memory>
+#include <string>
 #include <type_traits>
+#include <unordered_set>
 #include <utility>
 
 namespace pf = yk::polyfill;
@@ -323,6 +326,17 @@ TEST_CASE("ref optional")
   STATIC_REQUIRE(std::is_same<decltype(*std::declval<pf::optional<int&>&&>()), int&>::value);
   STATIC_REQUIRE(std::is_same<decltype(*std::declval<pf::optional<int&> const&&>()), int&>::value);
 
+  // representation
+  STATIC_REQUIRE(sizeof(pf::optional<int&>) == sizeof(int*));
+  STATIC_REQUIRE(std::is_trivially_copyable<pf::optional<int&>>::value);
+  STATIC_REQUIRE(!std::is_convertible<pf::optional<int&>, bool>::value);
+
+  // binding to a temporary is rejected
+  STATIC_REQUIRE(!std::is_constructible<pf::optional<int const&>, int>::value);
+  STATIC_REQUIRE(std::is_constructible<pf::optional<int const&>, int&>::value);
+  STATIC_REQUIRE(!std::is_constructible<pf::optional<Base const&>, Derived>::value);
+  STATIC_REQUIRE(std::is_constructible<pf::optional<Base const&>, Derived&>::value);
+
   // default construction
   {
     pf::optional<int&> opt;
@@ -582,6 +596,30 @@ TEST_CASE("ref optional")
       CHECK(opt.end() - opt.begin() == 1);
       CHECK(std::addressof(*opt.begin()) == std::addressof(x));
     }
+    {
+      // constness is shallow: iterating a const optional<int&> still yields int&
+      pf::optional<int&> const opt = x;
+      STATIC_REQUIRE(std::is_same<decltype(opt.begin()), It>::value);
+      STATIC_REQUIRE(std::is_same<decltype(*opt.begin()), int&>::value);
+      for (int& v : opt) v = 43;
+      CHECK(x == 43);
+    }
+  }
+
+  // swap
+  {
+    int x = 1, y = 2;
+    pf::optional<int&> a = x, b;
+    a.swap(b);
+    CHECK(!a.has_value());
+    CHECK(std::addressof(*b) == std::addressof(x));
+    b.swap(a);
+    a.swap(a);
+    CHECK(std::addressof(*a) == std::addressof(x));
+    b = y;
+    swap(a, b);
+    CHECK(std::addressof(*a) == std::addressof(y));
+    CHECK(std::addressof(*b) == std::addressof(x));
   }
 }
 
@@ -1458,3 +1496,21 @@ TEST_CASE("optional<T&> constexpr C++11")
     STATIC_REQUIRE(!null_opt.has_value());
   }
 }
+
+TEST_CASE("optional hash")
+{
+  struct NotHashable {};
+
+  STATIC_REQUIRE(!pf::is_invocable<std::hash<pf::optional<NotHashable>>, pf::optional<NotHashable> const&>::value);
+  STATIC_REQUIRE(noexcept(std::hash<pf::optional<int>>{}(std::declval<pf::optional<int> const&>())));
+
+  // engaged optional hashes like its value
+  CHECK(std::hash<pf::optional<std::string>>{}(std::string("abc")) == std::hash<std::string>{}("abc"));
+  CHECK(std::hash<pf::optional<int const>>{}(42) == std::hash<int>{}(42));
+
+  // disengaged optionals hash alike regardless of T
+  CHECK(std::hash<pf::optional<int>>{}(pf::nullopt) == std::hash<pf::optional<std::string>>{}(pf::nullopt));
+
+  std::unordered_set<pf::optional<int>> set{1, pf::nullopt, 2, pf::nullopt, 1};
+  CHECK(set.size() == 3);
+}
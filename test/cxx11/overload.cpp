@@ -0,0 +1,42 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/overload.hpp>
+
+#include <yk/polyfill/variant.hpp>
+
+#include <string>
+#include <type_traits>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+TEST_CASE("overload")
+{
+  SECTION("lambdas")
+  {
+    auto ov = ext::make_overload([](int i) { return i * 2; }, [](std::string const& s) { return static_cast<int>(s.size()); });
+    CHECK(ov(21) == 42);
+    CHECK(ov(std::string("abc")) == 3);
+  }
+
+  SECTION("empty function objects add no size")
+  {
+    auto a = [](int) {};
+    auto b = [](double) {};
+    STATIC_REQUIRE(std::is_empty<ext::overload<decltype(a), decltype(b)>>::value);
+  }
+
+  SECTION("with visit<R>")
+  {
+    pf::variant<int, std::string> v = std::string("hello");
+    auto ov = ext::make_overload([](int i) { return i; }, [](std::string const& s) { return s.size(); });
+    STATIC_REQUIRE(std::is_same<decltype(pf::visit<long>(ov, v)), long>::value);
+    CHECK(pf::visit<long>(ov, v) == 5);
+    v = 7;
+    CHECK(pf::visit<long>(ov, v) == 7);
+  }
+}
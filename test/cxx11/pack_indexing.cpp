@@ -0,0 +1,49 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/pack_indexing.hpp>
+
+#include <yk/polyfill/utility.hpp>
+
+#include <type_traits>
+
+#include <cstddef>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+namespace {
+
+template<class Seq>
+struct indexed_pack;
+
+template<std::size_t... Is>
+struct indexed_pack<pf::index_sequence<Is...>> {
+  template<std::size_t I>
+  using at = typename ext::pack_indexing<I, std::integral_constant<std::size_t, Is>...>::type;
+};
+
+}  // namespace
+
+TEST_CASE("pack_indexing")
+{
+  STATIC_REQUIRE(std::is_same<ext::pack_indexing<0, int>::type, int>::value);
+  STATIC_REQUIRE(std::is_same<ext::pack_indexing<0, int, double, char>::type, int>::value);
+  STATIC_REQUIRE(std::is_same<ext::pack_indexing<1, int, double, char>::type, double>::value);
+  STATIC_REQUIRE(std::is_same<ext::pack_indexing<2, int, double, char>::type, char>::value);
+
+  // cv and reference qualifiers are preserved
+  STATIC_REQUIRE(std::is_same<ext::pack_indexing<0, int const, int&>::type, int const>::value);
+  STATIC_REQUIRE(std::is_same<ext::pack_indexing<1, int const, int&>::type, int&>::value);
+  STATIC_REQUIRE(std::is_same<ext::pack_indexing<0, int&&>::type, int&&>::value);
+  STATIC_REQUIRE(std::is_same<ext::pack_indexing<1, void, void const>::type, void const>::value);
+
+  // large packs
+  using P = indexed_pack<pf::make_index_sequence<128>>;
+  STATIC_REQUIRE(P::at<0>::value == 0);
+  STATIC_REQUIRE(P::at<64>::value == 64);
+  STATIC_REQUIRE(P::at<127>::value == 127);
+}
@@ -0,0 +1,113 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/packed_tuple.hpp>
+
+#include <yk/polyfill/tuple.hpp>
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+namespace {
+
+struct Empty {};
+struct OtherEmpty {};
+
+struct Sorted {
+  double d;
+  int i;
+  char c1;
+  char c2;
+};
+
+}  // namespace
+
+TEST_CASE("packed_tuple")
+{
+  SECTION("layout")
+  {
+    STATIC_REQUIRE(sizeof(ext::packed_tuple<char, double, char, int>) == sizeof(Sorted));
+    STATIC_REQUIRE(sizeof(ext::packed_tuple<char, double, char, int>) <= sizeof(std::tuple<char, double, char, int>));
+    STATIC_REQUIRE(sizeof(ext::packed_tuple<int, Empty>) == sizeof(int));
+    STATIC_REQUIRE(sizeof(ext::packed_tuple<Empty, int, OtherEmpty>) == sizeof(int));
+    STATIC_REQUIRE(std::is_empty<ext::packed_tuple<Empty, OtherEmpty>>::value);
+    STATIC_REQUIRE(sizeof(ext::packed_tuple<Empty, Empty, int>) == sizeof(int));
+    STATIC_REQUIRE(sizeof(ext::packed_tuple<Empty, Empty, int>) <= sizeof(pf::tuple<Empty, Empty, int>));
+    STATIC_REQUIRE(sizeof(ext::packed_tuple<char, Empty, double, Empty>) <= sizeof(pf::tuple<char, Empty, double, Empty>));
+  }
+
+  SECTION("get keeps the declared order")
+  {
+    ext::packed_tuple<char, double, char, int> t('a', 3.5, 'b', 42);
+    CHECK(ext::get<0>(t) == 'a');
+    CHECK(ext::get<1>(t) == 3.5);
+    CHECK(ext::get<2>(t) == 'b');
+    CHECK(ext::get<3>(t) == 42);
+
+    ext::get<3>(t) = 7;
+    CHECK(ext::get<3>(t) == 7);
+
+    STATIC_REQUIRE(std::is_same<decltype(ext::get<1>(t)), double&>::value);
+    STATIC_REQUIRE(std::is_same<decltype(ext::get<1>(std::move(t))), double&&>::value);
+    STATIC_REQUIRE(std::is_same<decltype(ext::get<1>(static_cast<decltype(t) const&>(t))), double const&>::value);
+  }
+
+  SECTION("construction")
+  {
+    ext::packed_tuple<int, std::string> def;
+    CHECK(ext::get<0>(def) == 0);
+    CHECK(ext::get<1>(def).empty());
+
+    ext::packed_tuple<int, std::string> conv = {1, "one"};
+    CHECK(ext::get<1>(conv) == "one");
+
+    ext::packed_tuple<std::unique_ptr<int>, Empty> moved(std::unique_ptr<int>(new int(5)), Empty{});
+    auto other = std::move(moved);
+    CHECK(*ext::get<0>(other) == 5);
+    CHECK(ext::get<0>(moved) == nullptr);
+
+    auto made = ext::make_packed_tuple(1, 2.0, std::string("x"));
+    STATIC_REQUIRE(std::is_same<decltype(made), ext::packed_tuple<int, double, std::string>>::value);
+    CHECK(ext::get<2>(made) == "x");
+
+    int i = 1;
+    ext::packed_tuple<int&, char> ref(i, 'c');
+    ext::get<0>(ref) = 2;
+    CHECK(i == 2);
+  }
+
+  SECTION("tuple protocol")
+  {
+    using T = ext::packed_tuple<char, double, int>;
+    STATIC_REQUIRE(std::tuple_size<T>::value == 3);
+    STATIC_REQUIRE(std::is_same<std::tuple_element<1, T>::type, double>::value);
+
+    T t('a', 1.5, 2);
+    CHECK(pf::apply([](char c, double d, int n) { return c + d + n; }, t) == 'a' + 3.5);
+  }
+
+  SECTION("comparison and swap")
+  {
+    using T = ext::packed_tuple<char, int>;
+    T a('a', 1), b('a', 2);
+    CHECK(a == a);
+    CHECK(a != b);
+    CHECK(a < b);
+    CHECK(a <= b);
+    CHECK(b > a);
+    CHECK(b >= a);
+
+    swap(a, b);
+    CHECK(ext::get<1>(a) == 2);
+    CHECK(ext::get<1>(b) == 1);
+  }
+}
@@ -0,0 +1,204 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/soa_vector.hpp>
+
+#include <yk/polyfill/tuple.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+namespace {
+
+struct ThrowOnCopy {
+  static int live;
+  bool armed = false;
+
+  ThrowOnCopy() { ++live; }
+  explicit ThrowOnCopy(bool armed) : armed(armed) { ++live; }
+  ThrowOnCopy(ThrowOnCopy const& other) : armed(other.armed)
+  {
+    if (armed) throw std::runtime_error("copy");
+    ++live;
+  }
+  ~ThrowOnCopy() { --live; }
+};
+
+int ThrowOnCopy::live = 0;
+
+struct Sum {
+  int operator()(int& a, int const& b) const { return a + b; }
+};
+
+}  // namespace
+
+TEST_CASE("soa_vector")
+{
+  using V = ext::soa_vector<float, int, std::string>;
+  STATIC_REQUIRE(std::is_same<V::value_type, pf::tuple<float, int, std::string>>::value);
+  STATIC_REQUIRE(std::is_same<V::reference, pf::tuple<float&, int&, std::string&>>::value);
+  STATIC_REQUIRE(std::is_same<V::const_reference, pf::tuple<float const&, int const&, std::string const&>>::value);
+  STATIC_REQUIRE(std::is_nothrow_move_constructible<V>::value);
+
+  V v;
+  CHECK(v.empty());
+  CHECK(v.capacity() == 0);
+  CHECK(v.data<0>() == nullptr);
+
+  v.emplace_back(1.5f, 1, "one");
+  v.emplace_back(2.5f, 2, std::string("two"));
+  v.push_back(V::value_type(3.5f, 3, "three"));
+  REQUIRE(v.size() == 3);
+  CHECK(v.capacity() >= 3);
+
+  SECTION("columns are contiguous")
+  {
+    float const* xs = v.data<0>();
+    int const* ns = v.data<1>();
+    CHECK(xs[0] == 1.5f);
+    CHECK(xs[2] == 3.5f);
+    CHECK(ns[1] == 2);
+    CHECK(v.data<2>()[2] == "three");
+  }
+
+  SECTION("proxy references")
+  {
+    V::reference r = v[1];
+    pf::get<1>(r) = 20;
+    pf::get<2>(r) += "!";
+    CHECK(v.data<1>()[1] == 20);
+    CHECK(v.data<2>()[1] == "two!");
+
+    V const& cv = v;
+    CHECK(pf::get<0>(cv[0]) == 1.5f);
+    CHECK(pf::get<2>(cv.back()) == "three");
+    CHECK_THROWS_AS(cv.at(3), std::out_of_range);
+  }
+
+  SECTION("assigning and swapping rows")
+  {
+    v[0] = V::value_type(0.5f, 10, "ten");
+    CHECK(v.data<1>()[0] == 10);
+    CHECK(v.data<2>()[0] == "ten");
+
+    v[2] = v[0];
+    CHECK(v.data<0>()[2] == 0.5f);
+    CHECK(v.data<2>()[2] == "ten");
+
+    swap(v[0], v[1]);
+    CHECK(v.data<1>()[0] == 2);
+    CHECK(v.data<2>()[0] == "two");
+    CHECK(v.data<1>()[1] == 10);
+  }
+
+  SECTION("apply")
+  {
+    ext::soa_vector<int, int> w;
+    w.emplace_back(3, 4);
+    CHECK(pf::apply(Sum{}, w[0]) == 7);
+  }
+
+  SECTION("copy and move")
+  {
+    V copy = v;
+    pf::get<2>(copy[0]) = "uno";
+    CHECK(v.data<2>()[0] == "one");
+
+    V moved = std::move(copy);
+    CHECK(copy.empty());
+    CHECK(moved.size() == 3);
+    CHECK(moved.data<2>()[0] == "uno");
+
+    v = moved;
+    CHECK(v.data<2>()[0] == "uno");
+  }
+
+  SECTION("reserve keeps elements")
+  {
+    v.reserve(100);
+    CHECK(v.capacity() == 100);
+    CHECK(v.data<2>()[1] == "two");
+    for (int i = 0; i < 50; ++i) v.emplace_back(0.f, i, std::string(32, 'x'));
+    CHECK(v.size() == 53);
+    CHECK(v.data<1>()[52] == 49);
+  }
+
+  SECTION("emplace_back from its own elements while growing")
+  {
+    while (v.size() != v.capacity()) v.emplace_back(0.f, 0, "pad");
+    std::size_t const n = v.size();
+    v.emplace_back(pf::get<0>(v[0]), pf::get<1>(v[0]), pf::get<2>(v[0]));
+    REQUIRE(v.size() == n + 1);
+    CHECK(v.capacity() > n);
+    CHECK(pf::get<0>(v.back()) == 1.5f);
+    CHECK(pf::get<1>(v.back()) == 1);
+    CHECK(pf::get<2>(v.back()) == "one");
+    CHECK(v.data<2>()[0] == "one");
+  }
+
+  SECTION("pop_back and clear")
+  {
+    v.pop_back();
+    CHECK(v.size() == 2);
+    CHECK(pf::get<1>(v.back()) == 2);
+    v.clear();
+    CHECK(v.empty());
+    CHECK(v.capacity() >= 3);
+  }
+}
+
+TEST_CASE("soa_vector value-initializes")
+{
+  ext::soa_vector<int, double> v(4);
+  REQUIRE(v.size() == 4);
+  CHECK(v.data<0>()[3] == 0);
+  CHECK(v.data<1>()[0] == 0.0);
+}
+
+TEST_CASE("soa_vector move-only columns")
+{
+  ext::soa_vector<std::unique_ptr<int>, int> v;
+  for (int i = 0; i < 10; ++i) v.emplace_back(std::unique_ptr<int>(new int(i)), i);
+  CHECK(*v.data<0>()[9] == 9);
+  auto w = std::move(v);
+  CHECK(*pf::get<0>(w[5]) == 5);
+}
+
+TEST_CASE("soa_vector rolls back a failed emplace column-wise")
+{
+  {
+    ext::soa_vector<std::string, ThrowOnCopy> v;
+    v.emplace_back("a", ThrowOnCopy());
+    ThrowOnCopy const armed(true);
+    CHECK_THROWS_AS(v.emplace_back("b", armed), std::runtime_error);
+    CHECK(v.size() == 1);
+    CHECK(v.data<0>()[0] == "a");
+    CHECK(ThrowOnCopy::live == 2);
+
+    ext::soa_vector<ThrowOnCopy> armed_v;
+    armed_v.emplace_back(true);
+    CHECK_THROWS_AS(ext::soa_vector<ThrowOnCopy>(armed_v), std::runtime_error);
+  }
+  CHECK(ThrowOnCopy::live == 0);
+}
+
+#if __cpp_lib_span >= 202002L
+TEST_CASE("soa_vector column spans")
+{
+  ext::soa_vector<int, char> v;
+  v.emplace_back(1, 'a');
+  v.emplace_back(2, 'b');
+  std::span<int> ns = v.column<0>();
+  CHECK(ns.size() == 2);
+  CHECK(ns[1] == 2);
+}
+#endif
@@ -0,0 +1,147 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/strong_variant.hpp>
+
+#include <yk/polyfill/variant.hpp>
+
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+namespace {
+
+struct ThrowsOnInt {
+  int value;
+  ThrowsOnInt() : value(0) {}
+  explicit ThrowsOnInt(int) { throw std::runtime_error("ThrowsOnInt"); }
+  ThrowsOnInt(ThrowsOnInt const&) = default;
+  ThrowsOnInt(ThrowsOnInt&&) noexcept = default;
+  ThrowsOnInt& operator=(ThrowsOnInt const&) = default;
+  ThrowsOnInt& operator=(ThrowsOnInt&&) noexcept = default;
+};
+
+struct size_visitor {
+  std::size_t operator()(int) const { return sizeof(int); }
+  std::size_t operator()(std::string const& s) const { return s.size(); }
+};
+
+}  // namespace
+
+TEST_CASE("strong_variant")
+{
+  using V = ext::strong_variant<int, std::string>;
+
+  STATIC_REQUIRE(sizeof(V) == sizeof(pf::variant<int, std::string>));
+  STATIC_REQUIRE(pf::variant_size<V>::value == 2);
+  STATIC_REQUIRE(std::is_same<pf::variant_alternative<1, V>::type, std::string>::value);
+  STATIC_REQUIRE(ext::detail::strong_variadic_union<int, std::string>::never_valueless);
+  STATIC_REQUIRE(std::is_trivially_copyable<ext::strong_variant<int, double>>::value);
+  STATIC_REQUIRE(std::is_nothrow_move_constructible<V>::value);
+
+  SECTION("construction and get")
+  {
+    V a;
+    CHECK(a.index() == 0);
+    CHECK(!a.valueless_by_exception());
+    CHECK(ext::get<0>(a) == 0);
+
+    V b = std::string("foo");
+    CHECK(b.index() == 1);
+    CHECK(ext::holds_alternative<std::string>(b));
+    CHECK(ext::get<std::string>(b) == "foo");
+    CHECK_THROWS_AS(ext::get<int>(b), pf::bad_variant_access);
+
+    V c(pf::in_place_index_t<1>{}, 3, 'x');
+    CHECK(ext::get<1>(c) == "xxx");
+
+    V d(pf::in_place_type_t<int>{}, 42);
+    CHECK(*ext::get_if<int>(&d) == 42);
+    CHECK(ext::get_if<std::string>(&d) == nullptr);
+  }
+
+  SECTION("copy, move and assignment")
+  {
+    V a = std::string("bar");
+    V b = a;
+    CHECK(ext::get<1>(b) == "bar");
+    V c = std::move(b);
+    CHECK(ext::get<1>(c) == "bar");
+
+    a = 1;
+    CHECK(ext::get<0>(a) == 1);
+    a = c;
+    CHECK(ext::get<1>(a) == "bar");
+    a = V(7);
+    CHECK(ext::get<0>(a) == 7);
+    a = std::string("baz");
+    CHECK(ext::get<1>(a) == "baz");
+  }
+
+  SECTION("throwing emplace keeps the old value")
+  {
+    ext::strong_variant<int, ThrowsOnInt> v = 42;
+    CHECK_THROWS_AS(v.emplace<1>(0), std::runtime_error);
+    CHECK(v.index() == 0);
+    CHECK(ext::get<0>(v) == 42);
+
+    v.emplace<ThrowsOnInt>();
+    CHECK(v.index() == 1);
+    CHECK_THROWS_AS(v.emplace<1>(0), std::runtime_error);
+    CHECK(v.index() == 1);
+  }
+
+  SECTION("visit")
+  {
+    V a = 1;
+    V b = std::string("four");
+    CHECK(ext::visit(size_visitor{}, a) == sizeof(int));
+    CHECK(ext::visit(size_visitor{}, b) == 4);
+  }
+
+  SECTION("swap")
+  {
+    V a = 1;
+    V b = std::string("x");
+    swap(a, b);
+    CHECK(ext::get<1>(a) == "x");
+    CHECK(ext::get<0>(b) == 1);
+
+    V c = 2;
+    a.swap(c);
+    CHECK(ext::get<0>(a) == 2);
+    CHECK(ext::get<1>(c) == "x");
+  }
+
+  SECTION("comparison")
+  {
+    V a = 1;
+    V b = 2;
+    V s = std::string("a");
+    CHECK(a == a);
+    CHECK(a != b);
+    CHECK(a < b);
+    CHECK(b < s);
+    CHECK(s > a);
+    CHECK(a <= a);
+    CHECK(s >= b);
+  }
+
+  SECTION("hash")
+  {
+    V a = 1;
+    V b = 1;
+    V s = std::string("a");
+    CHECK(std::hash<V>{}(a) == std::hash<V>{}(b));
+    CHECK(std::hash<V>{}(a) == std::hash<pf::variant<int, std::string>>{}(pf::variant<int, std::string>(1)));
+    (void)std::hash<V>{}(s);
+  }
+}
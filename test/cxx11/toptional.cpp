@@ -5,8 +5,12 @@
 #endif
 
 #include <yk/polyfill/extension/toptional.hpp>
+#include <yk/polyfill/optional.hpp>
 
+#include <functional>
 #include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
 #include <vector>
 
 namespace pf = yk::polyfill;
@@ -348,6 +352,102 @@ TEST_CASE("toptional - transform with custom traits")
   }
 }
 
+TEST_CASE("toptional - reference")
+{
+  STATIC_REQUIRE(sizeof(ext::toptional<int&>) == sizeof(int*));
+  STATIC_REQUIRE(std::is_trivially_copyable<ext::toptional<int&>>::value);
+
+  // binding to a temporary is rejected
+  STATIC_REQUIRE(!std::is_constructible<ext::toptional<int const&>, int>::value);
+  STATIC_REQUIRE(!std::is_convertible<long, ext::toptional<int const&>>::value);
+  STATIC_REQUIRE(!std::is_constructible<ext::toptional<int const&>, pf::in_place_t, int>::value);
+  STATIC_REQUIRE(std::is_constructible<ext::toptional<int const&>, int&>::value);
+  STATIC_REQUIRE(std::is_constructible<ext::toptional<int const&>, pf::in_place_t, int const&>::value);
+
+  SECTION("construction")
+  {
+    ext::toptional<int&> empty;
+    CHECK(!empty.has_value());
+    CHECK(empty == pf::nullopt);
+    CHECK_THROWS_AS(empty.value(), pf::bad_optional_access);
+
+    int x = 42;
+    ext::toptional<int&> opt = x;
+    CHECK(opt.has_value());
+    CHECK(&*opt == &x);
+    *opt = 7;
+    CHECK(x == 7);
+
+    ext::toptional<int const&> copt = opt;
+    CHECK(&*copt == &x);
+  }
+
+  SECTION("rebinding")
+  {
+    int x = 1, y = 2;
+    ext::toptional<int&> opt = x;
+    opt.emplace(y);
+    CHECK(&*opt == &y);
+    CHECK(x == 1);
+    opt = pf::nullopt;
+    CHECK(!opt.has_value());
+    CHECK(opt.value_or(99) == 99);
+  }
+
+  SECTION("monadic operations")
+  {
+    int x = 21;
+    ext::toptional<int&> opt = x;
+    ext::toptional<int&> empty;
+
+    auto doubled = opt.transform([](int& v) { return v * 2; });
+    STATIC_REQUIRE(std::is_same<decltype(doubled), ext::toptional<int>>::value);
+    CHECK(*doubled == 42);
+    CHECK(!empty.transform([](int& v) { return v * 2; }).has_value());
+
+    auto custom = opt.transform<minus_one_traits<int>>([](int& v) { return v - 21; });
+    STATIC_REQUIRE(std::is_same<decltype(custom), ext::toptional<int, minus_one_traits<int>>>::value);
+    CHECK(*custom == 0);
+
+    auto chained = opt.and_then([](int& v) { return v > 0 ? ext::toptional<int>{v} : ext::toptional<int>{}; });
+    CHECK(*chained == 21);
+
+    int fallback = 5;
+    CHECK(&*empty.or_else([&] { return ext::toptional<int&>{fallback}; }) == &fallback);
+  }
+
+  SECTION("transform returning reference")
+  {
+    struct S {
+      int member;
+    };
+    S s{10};
+    ext::toptional<S*> opt = &s;
+    auto ref = opt.transform([](S* p) -> int& { return p->member; });
+    STATIC_REQUIRE(std::is_same<decltype(ref), ext::toptional<int&>>::value);
+    CHECK(&*ref == &s.member);
+
+    ext::toptional<S*> empty;
+    CHECK(!empty.transform([](S* p) -> int& { return p->member; }).has_value());
+  }
+
+  SECTION("iterator")
+  {
+    int x = 3;
+    ext::toptional<int&> opt = x;
+    int count = 0;
+    for (int& v : opt) {
+      ++v;
+      ++count;
+    }
+    CHECK(count == 1);
+    CHECK(x == 4);
+
+    ext::toptional<int&> empty;
+    CHECK(empty.begin() == empty.end());
+  }
+}
+
 // Non-trivial test types
 namespace {
 
@@ -1102,3 +1202,14 @@ TEST_CASE("toptional - emplace exception safety")
     CHECK(opt->value == 200);
   }
 }
+
+TEST_CASE("toptional - hash")
+{
+  using opt = ext::toptional<int>;
+
+  CHECK(std::hash<opt>{}(opt{42}) == std::hash<int>{}(42));
+  CHECK(std::hash<opt>{}(opt{}) == std::hash<pf::optional<int>>{}(pf::nullopt));
+
+  std::unordered_set<opt> set{opt{1}, opt{}, opt{2}, opt{}};
+  CHECK(set.size() == 3);
+}
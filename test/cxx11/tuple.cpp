@@ -0,0 +1,174 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/tuple.hpp>
+
+#include <yk/polyfill/type_traits.hpp>
+#include <yk/polyfill/utility.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace pf = yk::polyfill;
+
+namespace {
+
+struct Empty {};
+
+template<std::size_t... Is>
+pf::tuple<std::integral_constant<std::size_t, Is>...> make_wide(pf::index_sequence<Is...>)
+{
+  return {};
+}
+
+}  // namespace
+
+TEST_CASE("tuple")
+{
+  SECTION("construction and get")
+  {
+    pf::tuple<int, std::string, double> t(1, "one", 1.5);
+    CHECK(pf::get<0>(t) == 1);
+    CHECK(pf::get<1>(t) == "one");
+    CHECK(pf::get<2>(t) == 1.5);
+    CHECK(pf::get<std::string>(t) == "one");
+
+    STATIC_REQUIRE(std::is_same<decltype(pf::get<1>(t)), std::string&>::value);
+    STATIC_REQUIRE(std::is_same<decltype(pf::get<1>(std::move(t))), std::string&&>::value);
+    STATIC_REQUIRE(std::is_same<decltype(pf::get<1>(static_cast<decltype(t) const&>(t))), std::string const&>::value);
+    STATIC_REQUIRE(std::is_same<decltype(pf::get<double>(std::move(t))), double&&>::value);
+
+    pf::tuple<int, std::string> def;
+    CHECK(pf::get<0>(def) == 0);
+    CHECK(pf::get<1>(def).empty());
+
+    pf::tuple<int, std::string> implicit = {2, "two"};
+    CHECK(pf::get<1>(implicit) == "two");
+
+    pf::tuple<> empty;
+    (void)empty;
+    STATIC_REQUIRE(std::is_empty<pf::tuple<>>::value);
+    STATIC_REQUIRE(std::is_empty<pf::tuple<Empty>>::value);
+    STATIC_REQUIRE(sizeof(pf::tuple<int, Empty>) == sizeof(int));
+  }
+
+  SECTION("converting construction")
+  {
+    pf::tuple<int, char const*> src(1, "x");
+    pf::tuple<long, std::string> copied = src;
+    CHECK(pf::get<0>(copied) == 1);
+    CHECK(pf::get<1>(copied) == "x");
+
+    pf::tuple<std::unique_ptr<int>> owner(std::unique_ptr<int>(new int(3)));
+    pf::tuple<std::shared_ptr<int>> shared = std::move(owner);
+    CHECK(*pf::get<0>(shared) == 3);
+    CHECK(pf::get<0>(owner) == nullptr);
+
+    STATIC_REQUIRE(!std::is_convertible<pf::tuple<int>, pf::tuple<std::unique_ptr<int>>>::value);
+    STATIC_REQUIRE(!std::is_constructible<pf::tuple<int, int>, pf::tuple<int>>::value);
+  }
+
+  SECTION("make_tuple and forward_as_tuple")
+  {
+    int i = 1;
+    auto t = pf::make_tuple(i, std::ref(i), std::string("s"));
+    STATIC_REQUIRE(std::is_same<decltype(t), pf::tuple<int, int&, std::string>>::value);
+    pf::get<1>(t) = 5;
+    CHECK(i == 5);
+
+    auto f = pf::forward_as_tuple(i, std::string("tmp"));
+    STATIC_REQUIRE(std::is_same<decltype(f), pf::tuple<int&, std::string&&>>::value);
+    CHECK(&pf::get<0>(f) == &i);
+  }
+
+  SECTION("tuple protocol and apply")
+  {
+    using T = pf::tuple<char, double, int>;
+    STATIC_REQUIRE(std::tuple_size<T>::value == 3);
+    STATIC_REQUIRE(std::is_same<std::tuple_element<1, T>::type, double>::value);
+    STATIC_REQUIRE(pf::is_applicable<int (*)(char, double, int), T&>::value);
+    STATIC_REQUIRE(!pf::is_applicable<int (*)(char, double), T&>::value);
+    STATIC_REQUIRE(!pf::is_applicable<int (*)(int), int>::value);
+
+    T t('a', 1.5, 2);
+    CHECK(pf::apply([](char c, double d, int n) { return c + d + n; }, t) == 'a' + 3.5);
+    CHECK(pf::apply([](std::string s) { return s; }, pf::make_tuple(std::string("moved"))) == "moved");
+
+    auto wide = make_wide(pf::make_index_sequence<48>{});
+    STATIC_REQUIRE(std::tuple_size<decltype(wide)>::value == 48);
+    STATIC_REQUIRE(std::tuple_element<47, decltype(wide)>::type::value == 47);
+    CHECK(static_cast<std::size_t>(pf::get<47>(wide)) == 47);
+  }
+
+  SECTION("comparison and swap")
+  {
+    pf::tuple<int, std::string> a(1, "a"), b(1, "b");
+    CHECK(a == a);
+    CHECK(a != b);
+    CHECK(a < b);
+    CHECK(a <= b);
+    CHECK(b > a);
+    CHECK(b >= a);
+    CHECK(a == pf::tuple<long, std::string>(1, "a"));
+
+    swap(a, b);
+    CHECK(pf::get<1>(a) == "b");
+    CHECK(pf::get<1>(b) == "a");
+
+    a = b;
+    CHECK(a == b);
+  }
+
+  SECTION("assignment")
+  {
+    pf::tuple<long, std::string> wide;
+    wide = pf::tuple<int, char const*>(3, "three");
+    CHECK(pf::get<0>(wide) == 3);
+    CHECK(pf::get<1>(wide) == "three");
+
+    pf::tuple<std::unique_ptr<int>> owner;
+    owner = pf::tuple<std::unique_ptr<int>>(std::unique_ptr<int>(new int(4)));
+    CHECK(*pf::get<0>(owner) == 4);
+    STATIC_REQUIRE(!std::is_copy_assignable<pf::tuple<std::unique_ptr<int>>>::value);
+    STATIC_REQUIRE(std::is_nothrow_move_assignable<pf::tuple<std::unique_ptr<int>>>::value);
+  }
+
+  SECTION("tuples of references assign and swap through")
+  {
+    STATIC_REQUIRE(std::is_copy_assignable<pf::tuple<int&, std::string&>>::value);
+    STATIC_REQUIRE(!std::is_copy_assignable<pf::tuple<int const&>>::value);
+    STATIC_REQUIRE(!std::is_assignable<pf::tuple<int> const&, pf::tuple<int> const&>::value);
+    STATIC_REQUIRE(std::is_assignable<pf::tuple<int&> const&, pf::tuple<long>>::value);
+
+    int x = 1, y = 2;
+    std::string s = "s", t = "t";
+    pf::tuple<int&, std::string&> r(x, s);
+    r = pf::tuple<int, char const*>(10, "ten");
+    CHECK(x == 10);
+    CHECK(s == "ten");
+
+    pf::tuple<int&, std::string&> const q(y, t);
+    r = q;
+    CHECK(&pf::get<0>(r) == &x);
+    CHECK(x == 2);
+    CHECK(s == "t");
+
+    q = pf::make_tuple(5, std::string("five"));
+    CHECK(y == 5);
+    CHECK(t == "five");
+
+    x = 1;
+    swap(pf::tuple<int&, std::string&>(x, s), pf::tuple<int&, std::string&>(y, t));
+    CHECK(x == 5);
+    CHECK(y == 1);
+    CHECK(s == "five");
+    CHECK(t == "t");
+  }
+}
@@ -0,0 +1,182 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/unique_array.hpp>
+
+#include <yk/polyfill/memory.hpp>
+
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+namespace {
+
+struct counting_deleter {
+  int* count;
+  void operator()(int* p) const
+  {
+    ++*count;
+    delete[] p;
+  }
+};
+
+struct sized_deleter {
+  std::size_t* freed;
+  void operator()(int* p, std::size_t n) const
+  {
+    *freed += n;
+    delete[] p;
+  }
+};
+
+struct throwing_move_deleter {
+  throwing_move_deleter() = default;
+  throwing_move_deleter(throwing_move_deleter&&) noexcept(false) {}
+  void operator()(int* p) const { delete[] p; }
+};
+
+template<class T>
+void take(T);
+
+// `take<T>({args...})` compiles, i.e. T is copy-list-initializable from Args (no explicit constructor involved)
+template<class Void, class T, class... Args>
+struct is_implicitly_list_constructible_impl : std::false_type {};
+
+template<class T, class... Args>
+struct is_implicitly_list_constructible_impl<decltype(take<T>({std::declval<Args>()...})), T, Args...> : std::true_type {};
+
+template<class T, class... Args>
+struct is_implicitly_list_constructible : is_implicitly_list_constructible_impl<void, T, Args...> {};
+
+}  // namespace
+
+TEST_CASE("unique_array")
+{
+  STATIC_REQUIRE(sizeof(ext::unique_array<int>) == sizeof(int*) + sizeof(std::size_t));
+  STATIC_REQUIRE(!std::is_copy_constructible<ext::unique_array<int>>::value);
+  STATIC_REQUIRE(std::is_nothrow_move_constructible<ext::unique_array<int>>::value);
+  STATIC_REQUIRE(std::is_same<ext::unique_array<int>::iterator, int*>::value);
+
+  // taking ownership of a raw pointer is explicit, as for unique_ptr
+  STATIC_REQUIRE(std::is_constructible<ext::unique_array<int>, int*, std::size_t>::value);
+  STATIC_REQUIRE(!is_implicitly_list_constructible<ext::unique_array<int>, int*, std::size_t>::value);
+  STATIC_REQUIRE(!is_implicitly_list_constructible<ext::unique_array<int, counting_deleter>, int*, std::size_t, counting_deleter>::value);
+
+  STATIC_REQUIRE(std::is_nothrow_constructible<ext::unique_array<int>, pf::unique_ptr<int[]>&&, std::size_t>::value);
+  STATIC_REQUIRE(!std::is_nothrow_constructible<
+                 ext::unique_array<int, throwing_move_deleter>, pf::unique_ptr<int[], throwing_move_deleter>&&, std::size_t>::value);
+
+  SECTION("default")
+  {
+    ext::unique_array<int> a;
+    CHECK(!a);
+    CHECK(a == nullptr);
+    CHECK(a.empty());
+    CHECK(a.size() == 0);
+    CHECK(a.begin() == a.end());
+  }
+
+  SECTION("make_unique_array value-initializes")
+  {
+    auto a = ext::make_unique_array<int>(4);
+    STATIC_REQUIRE(std::is_same<decltype(a), ext::unique_array<int>>::value);
+    CHECK(a != nullptr);
+    CHECK(a.size() == 4);
+    CHECK(a.size_bytes() == 4 * sizeof(int));
+    for (int x : a) CHECK(x == 0);
+  }
+
+  SECTION("make_unique_array_for_overwrite")
+  {
+    auto a = ext::make_unique_array_for_overwrite<int>(3);
+    CHECK(a.size() == 3);
+    int i = 0;
+    for (int& x : a) x = i++;
+    CHECK(a.front() == 0);
+    CHECK(a[1] == 1);
+    CHECK(a.back() == 2);
+    CHECK(*a.rbegin() == 2);
+    CHECK(a.end() - a.begin() == 3);
+  }
+
+  SECTION("shallow const")
+  {
+    auto const a = ext::make_unique_array<int>(1);
+    STATIC_REQUIRE(std::is_same<decltype(a[0]), int&>::value);
+    a[0] = 42;
+    CHECK(*a.data() == 42);
+  }
+
+  SECTION("move and release")
+  {
+    auto a = ext::make_unique_array<int>(2);
+    int* p = a.get();
+    ext::unique_array<int> b = std::move(a);
+    CHECK(!a);
+    CHECK(a.size() == 0);
+    CHECK(b.get() == p);
+    CHECK(b.size() == 2);
+
+    ext::unique_array<int> c;
+    c = std::move(b);
+    CHECK(c.get() == p);
+    CHECK(c.size() == 2);
+
+    int* released = c.release();
+    CHECK(released == p);
+    CHECK(c.empty());
+    delete[] released;
+  }
+
+  SECTION("swap")
+  {
+    auto a = ext::make_unique_array<int>(1);
+    auto b = ext::make_unique_array<int>(3);
+    int* pa = a.get();
+    swap(a, b);
+    CHECK(a.size() == 3);
+    CHECK(b.size() == 1);
+    CHECK(b.get() == pa);
+  }
+
+  SECTION("custom deleter")
+  {
+    int count = 0;
+    {
+      ext::unique_array<int, counting_deleter> a(new int[2], 2, counting_deleter{&count});
+      a.reset(new int[5], 5);
+      CHECK(count == 1);
+      CHECK(a.size() == 5);
+      a = nullptr;
+      CHECK(count == 2);
+      CHECK(a.size() == 0);
+    }
+    CHECK(count == 2);
+  }
+
+  SECTION("sized deleter receives the length")
+  {
+    std::size_t freed = 0;
+    {
+      ext::unique_array<int, sized_deleter> a(new int[7], 7, sized_deleter{&freed});
+    }
+    CHECK(freed == 7);
+  }
+
+  SECTION("from unique_ptr<T[]>")
+  {
+    auto u = pf::make_unique<int[]>(3);
+    int* p = u.get();
+    ext::unique_array<int> a(std::move(u), 3);
+    CHECK(!u);
+    CHECK(a.get() == p);
+    CHECK(a.size() == 3);
+  }
+}
@@ -6,7 +6,10 @@
 
 #include <yk/polyfill/variant.hpp>
 
+#include <functional>
+#include <string>
 #include <type_traits>
+#include <unordered_set>
 
 namespace pf = yk::polyfill;
 
@@ -26,6 +29,31 @@ void make_valueless(pf::variant<int, ThrowsOnConstruction>& var)
   }
 }
 
+struct ComparableThrowsOnConstruction {
+  ComparableThrowsOnConstruction() { throw std::exception{}; }
+  ComparableThrowsOnConstruction(ComparableThrowsOnConstruction const&) noexcept {}
+  ComparableThrowsOnConstruction& operator=(ComparableThrowsOnConstruction const&) noexcept { return *this; }
+#if __cplusplus >= 202002L
+  auto operator<=>(ComparableThrowsOnConstruction const&) const = default;
+#else
+  bool operator==(ComparableThrowsOnConstruction const&) const { return true; }
+  bool operator!=(ComparableThrowsOnConstruction const&) const { return false; }
+  bool operator<(ComparableThrowsOnConstruction const&) const { return false; }
+  bool operator<=(ComparableThrowsOnConstruction const&) const { return true; }
+  bool operator>(ComparableThrowsOnConstruction const&) const { return false; }
+  bool operator>=(ComparableThrowsOnConstruction const&) const { return true; }
+#endif
+};
+
+namespace std {
+
+template<>
+struct hash<ThrowsOnConstruction> {
+  std::size_t operator()(ThrowsOnConstruction const&) const noexcept { return 0; }
+};
+
+}  // namespace std
+
 struct NotDefaultConstructible {
   NotDefaultConstructible(int) {}
 };
@@ -34,6 +62,50 @@ struct NonTriviallyDestructible {
   ~NonTriviallyDestructible() {}
 };
 
+// Copying and moving may throw and are counted; declared trivially relocatable below.
+struct CountingRelocatable {
+  static int copies_and_moves;
+  int value;
+
+  explicit CountingRelocatable(int v) noexcept : value(v) {}
+  CountingRelocatable(CountingRelocatable const& other) : value(other.value)
+  {
+    ++copies_and_moves;
+    if (value < 0) throw std::exception{};
+  }
+  CountingRelocatable(CountingRelocatable&& other) : value(other.value) { ++copies_and_moves; }
+  CountingRelocatable& operator=(CountingRelocatable const& other)
+  {
+    ++copies_and_moves;
+    value = other.value;
+    return *this;
+  }
+  CountingRelocatable& operator=(CountingRelocatable&& other)
+  {
+    ++copies_and_moves;
+    value = other.value;
+    return *this;
+  }
+  ~CountingRelocatable() {}
+};
+
+int CountingRelocatable::copies_and_moves = 0;
+
+namespace yk {
+
+namespace polyfill {
+
+namespace extension {
+
+template<>
+struct is_trivially_relocatable<CountingRelocatable> : true_type {};
+
+}  // namespace extension
+
+}  // namespace polyfill
+
+}  // namespace yk
+
 // Trivially copyable types with restricted special member functions.
 // Each type has exactly one eligible trivial copy/move operation.
 // Used to verify that the library selects the correct trivial operation.
@@ -479,6 +551,30 @@ TEST_CASE("variant generic assignment")
   }
 }
 
+TEST_CASE("variant assignment relocates a trivially relocatable temporary")
+{
+  using V = pf::variant<std::string, CountingRelocatable>;
+
+  SECTION("construction throws")
+  {
+    V v = std::string("keep");
+    CountingRelocatable const bad(-1);
+    CHECK_THROWS(v = bad);
+    REQUIRE(!v.valueless_by_exception());
+    CHECK(pf::get<0>(v) == "keep");
+  }
+  SECTION("construction succeeds")
+  {
+    V v = std::string("replace");
+    CountingRelocatable const good(42);
+    CountingRelocatable::copies_and_moves = 0;
+    v = good;
+    CHECK(v.index() == 1);
+    CHECK(pf::get<1>(v).value == 42);
+    CHECK(CountingRelocatable::copies_and_moves == 1);  // the copy into the temporary, which is then relocated
+  }
+}
+
 TEST_CASE("variant in-place type construction")
 {
   STATIC_REQUIRE(std::is_constructible<pf::variant<int, double>, pf::in_place_type_t<int>, int>::value);
@@ -665,6 +761,24 @@ TEST_CASE("variant get_if by type")
   }
 }
 
+template<class T, class = void>
+struct has_value_member : std::false_type {};
+
+template<class T>
+struct has_value_member<T, pf::void_t<decltype(T::value)>> : std::true_type {};
+
+template<class Seq>
+struct many_alternatives;
+
+template<std::size_t... Is>
+struct many_alternatives<pf::index_sequence<Is...>> {
+  template<class T>
+  using find = pf::detail::find_index<T, std::integral_constant<std::size_t, Is>...>;
+
+  template<class T>
+  using once = pf::detail::exactly_once<T, std::integral_constant<std::size_t, Is>...>;
+};
+
 TEST_CASE("detail::exactly_once")
 {
   namespace dv = pf::detail;
@@ -718,6 +832,18 @@ TEST_CASE("detail::find_index")
 
   // cv-qualified types
   STATIC_REQUIRE(dv::find_index<int const, int, int const>::value == 1);
+
+  // not found: no `value` member (SFINAE-friendly)
+  STATIC_REQUIRE(!has_value_member<dv::find_index<int, double, char>>::value);
+  STATIC_REQUIRE(!has_value_member<dv::find_index<int>>::value);
+
+  // large packs
+  using L = many_alternatives<pf::make_index_sequence<64>>;
+  STATIC_REQUIRE(L::find<std::integral_constant<std::size_t, 0>>::value == 0);
+  STATIC_REQUIRE(L::find<std::integral_constant<std::size_t, 63>>::value == 63);
+  STATIC_REQUIRE(!has_value_member<L::find<int>>::value);
+  STATIC_REQUIRE(L::once<std::integral_constant<std::size_t, 42>>::value);
+  STATIC_REQUIRE(!L::once<int>::value);
 }
 
 TEST_CASE("variant noexcept")
@@ -885,6 +1011,23 @@ TEST_CASE("variant visit")
 
 TEST_CASE("variant multi-visit")
 {
+  SECTION("explicit return type")
+  {
+    pf::variant<int, double> v1 = 42;
+    pf::variant<char, float> v2 = 'a';
+    struct visitor {
+      int operator()(int i, char c) const { return i + c; }
+      long operator()(int, float) const { return 1; }
+      short operator()(double, char) const { return 2; }
+      char operator()(double, float) const { return 3; }
+    };
+    STATIC_REQUIRE(std::is_same<decltype(pf::visit<long>(visitor{}, v1, v2)), long>::value);
+    CHECK(pf::visit<long>(visitor{}, v1, v2) == 42 + 'a');
+    v1 = 1.0;
+    v2 = 1.0f;
+    CHECK(pf::visit<long>(visitor{}, v1, v2) == 3);
+    pf::visit<void>(visitor{}, v1, v2);
+  }
   SECTION("two variants")
   {
     pf::variant<int, double> v1 = 42;
@@ -1009,6 +1152,38 @@ TEST_CASE("variant swap")
     CHECK(a.valueless_by_exception());
     CHECK(b.valueless_by_exception());
   }
+  SECTION("trivially relocatable alternatives")
+  {
+    using V = pf::variant<int, CountingRelocatable, pf::unique_ptr<int>>;
+    STATIC_REQUIRE(noexcept(std::declval<V&>().swap(std::declval<V&>())));
+    STATIC_REQUIRE(!noexcept(std::declval<pf::variant<int, ThrowsOnConstruction, CountingRelocatable>&>().swap(
+        std::declval<pf::variant<int, ThrowsOnConstruction, CountingRelocatable>&>()
+    )));
+
+    V a(pf::in_place_index_t<1>{}, 42);
+    V b(pf::in_place_index_t<2>{}, new int(7));
+    int* const p = pf::get<2>(b).get();
+    CountingRelocatable::copies_and_moves = 0;
+
+    a.swap(b);
+    CHECK(a.index() == 2);
+    CHECK(pf::get<2>(a).get() == p);
+    CHECK(b.index() == 1);
+    CHECK(pf::get<1>(b).value == 42);
+
+    V c(pf::in_place_index_t<1>{}, 99);
+    swap(b, c);
+    CHECK(pf::get<1>(b).value == 99);
+    CHECK(pf::get<1>(c).value == 42);
+    CHECK(CountingRelocatable::copies_and_moves == 0);
+
+    a.swap(a);
+    swap(a, a);
+    CHECK(a.index() == 2);
+    CHECK(pf::get<2>(a).get() == p);
+    CHECK(*pf::get<2>(a) == 7);
+    CHECK(CountingRelocatable::copies_and_moves == 0);
+  }
 }
 
 TEST_CASE("monostate comparisons")
@@ -1068,6 +1243,33 @@ TEST_CASE("variant comparison operators")
     CHECK((a <= b));
     CHECK((a >= b));
   }
+  SECTION("every alternative of a wider variant")
+  {
+    using V = pf::variant<char, short, int, long, long long>;
+    V lo[] = {V(pf::in_place_index_t<0>{}, 1), V(pf::in_place_index_t<1>{}, 1), V(pf::in_place_index_t<2>{}, 1), V(pf::in_place_index_t<3>{}, 1), V(pf::in_place_index_t<4>{}, 1)};
+    V hi[] = {V(pf::in_place_index_t<0>{}, 2), V(pf::in_place_index_t<1>{}, 2), V(pf::in_place_index_t<2>{}, 2), V(pf::in_place_index_t<3>{}, 2), V(pf::in_place_index_t<4>{}, 2)};
+    for (int i = 0; i < 5; ++i) {
+      CHECK((lo[i] == lo[i]));
+      CHECK((lo[i] != hi[i]));
+      CHECK((lo[i] < hi[i]));
+      CHECK((hi[i] >= lo[i]));
+      if (i + 1 < 5) CHECK((hi[i] < lo[i + 1]));
+    }
+  }
+  SECTION("valueless")
+  {
+    pf::variant<int, ComparableThrowsOnConstruction> a = 1;
+    pf::variant<int, ComparableThrowsOnConstruction> b;
+    try {
+      b.emplace<1>();
+    } catch (...) {
+    }
+    REQUIRE(b.valueless_by_exception());
+    CHECK(!(a == b));
+    CHECK((b < a));
+    CHECK(!(a <= b));
+    CHECK((b == b));
+  }
 }
 
 TEST_CASE("trivially copyable variant emplace (same index)")
@@ -1245,3 +1447,43 @@ TEST_CASE("monostate constexpr comparison")
 }
 
 
+
+TEST_CASE("variant hash")
+{
+  struct NotHashable {};
+
+  STATIC_REQUIRE(pf::is_invocable<std::hash<pf::variant<int, std::string>>, pf::variant<int, std::string> const&>::value);
+  STATIC_REQUIRE(!pf::is_invocable<std::hash<pf::variant<int, NotHashable>>, pf::variant<int, NotHashable> const&>::value);
+  STATIC_REQUIRE(noexcept(std::hash<pf::variant<int, double>>{}(std::declval<pf::variant<int, double> const&>())));
+
+  SECTION("equal values hash equal")
+  {
+    pf::variant<int, std::string> a = std::string("abc"), b = std::string("abc");
+    CHECK(std::hash<pf::variant<int, std::string>>{}(a) == std::hash<pf::variant<int, std::string>>{}(b));
+  }
+
+  SECTION("index participates")
+  {
+    using V = pf::variant<int, long, unsigned>;
+    std::hash<V> h;
+    CHECK(h(V(pf::in_place_index_t<0>{}, 1)) != h(V(pf::in_place_index_t<1>{}, 1L)));
+    CHECK(h(V(pf::in_place_index_t<1>{}, 1L)) != h(V(pf::in_place_index_t<2>{}, 1u)));
+    CHECK(h(V(pf::in_place_index_t<0>{}, 1)) != h(V(pf::in_place_index_t<1>{}, 0L)));
+  }
+
+  SECTION("valueless")
+  {
+    pf::variant<int, ThrowsOnConstruction> a, b = 42;
+    make_valueless(a);
+    make_valueless(b);
+    std::hash<pf::variant<int, ThrowsOnConstruction>> h;
+    CHECK(h(a) == h(b));
+  }
+
+  SECTION("monostate")
+  {
+    CHECK(std::hash<pf::monostate>{}(pf::monostate{}) == std::hash<pf::monostate>{}(pf::monostate{}));
+    std::unordered_set<pf::variant<pf::monostate, int>> set{pf::monostate{}, 1, 2, pf::monostate{}, 1};
+    CHECK(set.size() == 3);
+  }
+}
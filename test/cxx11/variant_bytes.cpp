@@ -0,0 +1,83 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/variant_bytes.hpp>
+
+#include <yk/polyfill/bit.hpp>
+#include <yk/polyfill/variant.hpp>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cstring>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+TEST_CASE("variant_bytes")
+{
+  using V = pf::variant<int, double, char>;
+
+  STATIC_REQUIRE(ext::is_byte_copyable_variant<V>::value);
+  STATIC_REQUIRE(ext::is_byte_copyable_variant<V const>::value);
+  STATIC_REQUIRE(!ext::is_byte_copyable_variant<pf::variant<int, std::string>>::value);
+  STATIC_REQUIRE(!ext::is_byte_copyable_variant<int>::value);
+  STATIC_REQUIRE(std::is_trivially_copyable<V>::value);
+  STATIC_REQUIRE(std::is_same<decltype(ext::to_bytes(std::declval<V const&>())), ext::variant_byte_array<V>>::value);
+
+  SECTION("round trip")
+  {
+    V v = 2.5;
+    auto bytes = ext::to_bytes(v);
+    auto back = ext::from_bytes<V>(bytes);
+    REQUIRE(back.has_value());
+    CHECK(back->index() == 1);
+    CHECK(pf::get<double>(*back) == 2.5);
+
+    unsigned char raw[sizeof(V)];
+    ext::to_bytes(V(pf::in_place_index_t<2>{}, 'x'), raw);
+    auto back2 = ext::from_bytes<V>(raw, sizeof(raw));
+    REQUIRE(back2.has_value());
+    CHECK(pf::get<char>(*back2) == 'x');
+  }
+
+  SECTION("bit_cast compatible")
+  {
+    V v = 42;
+    auto bytes = pf::bit_cast<ext::variant_byte_array<V>>(v);
+    auto back = ext::from_bytes<V>(bytes);
+    REQUIRE(back.has_value());
+    CHECK(pf::get<int>(*back) == 42);
+  }
+
+  SECTION("rejects wrong size and invalid index")
+  {
+    unsigned char raw[sizeof(V)];
+    ext::to_bytes(V(1), raw);
+    CHECK(!ext::from_bytes<V>(raw, sizeof(raw) - 1).has_value());
+
+    unsigned char garbage[sizeof(V)];
+    std::memset(garbage, 0x7f, sizeof(garbage));  // every byte, the index included, is 0x7f
+    CHECK(!ext::from_bytes<V>(garbage, sizeof(garbage)).has_value());
+  }
+
+  SECTION("arrays")
+  {
+    std::vector<V> src{V(1), V(2.0), V(pf::in_place_index_t<2>{}, 'c'), V(4)};
+    std::vector<unsigned char> buffer(src.size() * sizeof(V));
+    ext::to_bytes(src.data(), src.size(), buffer.data());
+
+    std::vector<V> dst(src.size());
+    REQUIRE(ext::from_bytes(buffer.data(), dst.size(), dst.data()));
+    CHECK(dst == src);
+
+    std::vector<V> untouched(src.size());
+    std::memset(buffer.data() + 2 * sizeof(V), 0x7f, sizeof(V));
+    CHECK(!ext::from_bytes(buffer.data(), untouched.size(), untouched.data()));
+    CHECK(untouched == std::vector<V>(src.size()));
+  }
+}
@@ -0,0 +1,95 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/variant_dispatch.hpp>
+
+#include <yk/polyfill/type_traits.hpp>
+#include <yk/polyfill/variant.hpp>
+
+#include <exception>
+#include <string>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+namespace {
+
+struct index_recorder {
+  template<std::size_t I>
+  std::size_t operator()(pf::integral_constant<std::size_t, I>) const
+  {
+    return I * 10;
+  }
+};
+
+struct Throws {
+  Throws() { throw std::exception{}; }
+  Throws(Throws const&) noexcept {}
+  Throws& operator=(Throws const&) noexcept { return *this; }
+};
+
+struct on_int_or_string {
+  int operator()(int i) const { return i; }
+  int operator()(std::string& s) const
+  {
+    s += "!";
+    return static_cast<int>(s.size());
+  }
+};
+
+struct fallback {
+  template<class V>
+  long operator()(V const& v) const
+  {
+    return v.valueless_by_exception() ? -1 : -static_cast<long>(v.index());
+  }
+};
+
+}  // namespace
+
+TEST_CASE("visit_index")
+{
+  pf::variant<int, std::string, double> v = 3.0;
+  STATIC_REQUIRE(std::is_same<decltype(ext::visit_index(v, index_recorder{})), std::size_t>::value);
+  CHECK(ext::visit_index(v, index_recorder{}) == 20);
+  v = std::string("x");
+  CHECK(ext::visit_index(v, index_recorder{}) == 10);
+
+  pf::variant<int, Throws> valueless = 1;
+  try {
+    valueless.emplace<1>();
+  } catch (...) {
+  }
+  REQUIRE(valueless.valueless_by_exception());
+  CHECK_THROWS_AS(ext::visit_index(valueless, index_recorder{}), pf::bad_variant_access);
+}
+
+TEST_CASE("match_if")
+{
+  using V = pf::variant<int, std::string, double>;
+
+  V v = 4;
+  STATIC_REQUIRE(std::is_same<decltype(ext::match_if<int, std::string>(v, on_int_or_string{}, fallback{})), long>::value);
+  CHECK(ext::match_if<int, std::string>(v, on_int_or_string{}, fallback{}) == 4);
+
+  v = std::string("ab");
+  CHECK(ext::match_if<int, std::string>(v, on_int_or_string{}, fallback{}) == 3);
+  CHECK(pf::get<std::string>(v) == "ab!");  // f receives a mutable reference
+
+  v = 1.5;
+  CHECK(ext::match_if<int, std::string>(v, on_int_or_string{}, fallback{}) == -2);
+  CHECK(ext::match_if<>(v, on_int_or_string{}, fallback{}) == -2);
+
+  pf::variant<int, Throws> valueless = 1;
+  try {
+    valueless.emplace<1>();
+  } catch (...) {
+  }
+  CHECK(ext::match_if<int>(valueless, [](int) { return 0L; }, fallback{}) == -1);
+}
@@ -0,0 +1,21 @@
+#if YK_POLYFILL_CATCH2_MAJOR_VERSION < 3
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+
+#include <yk/polyfill/extension/overload.hpp>
+
+#include <yk/polyfill/variant.hpp>
+
+#include <string>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+TEST_CASE("overload deduction guide")
+{
+  pf::variant<int, std::string> v = 3;
+  auto const n = pf::visit<std::size_t>(ext::overload{[](int i) { return i; }, [](std::string const& s) { return s.size(); }}, v);
+  CHECK(n == 3);
+}
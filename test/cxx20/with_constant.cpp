@@ -0,0 +1,80 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <yk/polyfill/extension/with_constant.hpp>
+
+#include <yk/polyfill/tuple.hpp>
+#include <yk/polyfill/type_traits.hpp>
+
+#include <stdexcept>
+#include <type_traits>
+
+namespace pf = yk::polyfill;
+namespace ext = pf::extension;
+
+namespace {
+
+enum class mode { add, sub, mul };
+
+template<mode M>
+constexpr int apply_mode(int a, int b)
+{
+  if constexpr (M == mode::add) return a + b;
+  else if constexpr (M == mode::sub) return a - b;
+  else return a * b;
+}
+
+// one kernel for both runtime and compile-time strides
+template<class Stride>
+constexpr int sum_strided(int const* data, int n, Stride stride)
+{
+  int sum = 0;
+  for (int i = 0; i < n; i += stride) sum += data[i];
+  return sum;
+}
+
+}  // namespace
+
+TEST_CASE("is_constant_wrapper")
+{
+  STATIC_REQUIRE(ext::is_constant_wrapper<decltype(pf::cw<4>)>::value);
+  STATIC_REQUIRE(ext::is_constant_wrapper_v<pf::constant_wrapper<mode::add> const&>);
+  STATIC_REQUIRE(!ext::is_constant_wrapper_v<int>);
+  STATIC_REQUIRE(!ext::is_constant_wrapper_v<std::integral_constant<int, 4>>);
+}
+
+TEST_CASE("with_constant")
+{
+  auto const as_value = [](auto c) {
+    static_assert(ext::is_constant_wrapper_v<decltype(c)>);
+    return static_cast<int>(decltype(c)::value);
+  };
+  for (int i = 0; i < 8; ++i) CHECK(ext::with_constant<8>(i, as_value) == i);
+
+  CHECK_THROWS_AS(ext::with_constant<8>(8, as_value), std::out_of_range);
+  CHECK_THROWS_AS(ext::with_constant<8>(-1, as_value), std::out_of_range);
+
+  // enumerations select a specialization per enumerator
+  auto const run = [](auto m) { return apply_mode<decltype(m)::value>(6, 3); };
+  CHECK(ext::with_constant<3>(mode::add, run) == 9);
+  CHECK(ext::with_constant<3>(mode::sub, run) == 3);
+  CHECK(ext::with_constant<3>(mode::mul, run) == 18);
+
+  // the same kernel runs with a runtime or a compile-time stride
+  int const data[] = {1, 2, 3, 4, 5, 6, 7, 8};
+  int const runtime_stride = 2;
+  CHECK(sum_strided(data, 8, runtime_stride) == 16);
+  CHECK(ext::with_constant<5>(runtime_stride, [&](auto stride) { return sum_strided(data, 8, stride); }) == 16);
+
+  // results are converted to the result type for the first constant
+  auto const mixed = [](auto c) {
+    if constexpr (decltype(c)::value == 0) return 0.5;
+    else return 1;
+  };
+  STATIC_REQUIRE(std::is_same_v<decltype(ext::with_constant<2>(1, mixed)), double>);
+  CHECK(ext::with_constant<2>(1, mixed) == 1.0);
+
+  STATIC_REQUIRE(ext::with_constant<4>(3u, as_value) == 3);
+
+  // constant_wrapper arguments pass through apply unchanged
+  CHECK(pf::apply([](auto m, int a) { return apply_mode<decltype(m)::value>(a, 2); }, pf::make_tuple(pf::cw<mode::mul>, 21)) == 42);
+}